@@ -0,0 +1,79 @@
+#ifndef BATCH_QUERY_UTILITY_H
+#define BATCH_QUERY_UTILITY_H
+
+// included headers
+#include "RB_Utility.h"
+
+// prototypes
+
+/*
+Name: readBatchTarget
+Process: reads next whitespace separated integer target, skipping any
+         token that is not an integer, returns true if a target was read,
+         false at end of input
+Function Input/Parameters: target input file (FILE *)
+Function Output/Parameters: target read (int *)
+Function Output/Returned: success of operation (bool)
+Device Input/file: target captured from file
+Device Output/---: none
+Dependencies: fscanf
+*/
+bool readBatchTarget( FILE *targetFile, int *target );
+
+/*
+Name: runBatchQueries
+Process: answers every target read from the target file against the one
+         loaded grid and prune table, reusing one result set, 
+         writing a header line and then one result line per target 
+         in the order read, returns number of targets answered;
+         REACHABILITY_SEARCH can find targets the other engines
+         report as not found, as findSumReachable describes
+Function Input/Parameters: pointer to data array (const ArrayType *),
+                           pointer to prune table (const PruneTableType *),
+                           NULL searches without pruning,
+                           search engine (SearchModes),
+                           target input file (FILE *),
+                           result output file (FILE *)
+Function Output/Parameters: none
+Function Output/Returned: number of targets answered (int)
+Device Input/file: targets captured from file
+Device Output/file: results written to file
+Dependencies: initializeGridSet, initializeSearchContext, readBatchTarget,
+              runSearch, writeBatchHeader, writeBatchResult, emptySet, 
+              clearSet
+*/
+int runBatchQueries( const ArrayType *dataArray, 
+                     const PruneTableType *pruneTable, SearchModes searchMode,
+                     FILE *targetFile, FILE *resultFile );
+
+/*
+Name: writeBatchHeader
+Process: writes comma separated column names for batch results
+Function Input/Parameters: result output file (FILE *)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/---: none
+Device Output/file: header line written to file
+Dependencies: fputs
+*/
+void writeBatchHeader( FILE *resultFile );
+
+/*
+Name: writeBatchResult
+Process: writes one comma separated result line: target, 1 or 0 for
+         found, iteration and pruned counts, path length, and the path 
+         as space separated row:column cells, empty if not found
+Function Input/Parameters: result output file (FILE *),
+                           pointer to search data after the search
+                                                (const SearchContextType *),
+                           result of search (bool)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/---: none
+Device Output/file: result line written to file
+Dependencies: fprintf, fputc
+*/
+void writeBatchResult( FILE *resultFile, const SearchContextType *searchData,
+                                                                bool found );
+
+#endif  // BATCH_QUERY_UTILITY_H
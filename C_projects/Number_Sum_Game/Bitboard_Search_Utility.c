@@ -0,0 +1,366 @@
+// included headers
+#include "Bitboard_Search_Utility.h"
+
+/*
+Name: getTraceCell
+Process: returns cell with given value and location for reporting
+Function Input/Parameters: value, x and y indices (int)
+Function Output/Parameters: none
+Function Output/Returned: cell (CellDataType)
+Device Input/---: none
+Device Output/---: none
+Dependencies: setCellData
+*/
+static CellDataType getTraceCell( int value, int xIndex, int yIndex )
+   {
+    CellDataType current;
+
+    setCellData( &current, value, xIndex, yIndex );
+
+    return current;
+   }
+
+/*
+Name: checkBitboardLocation
+Process: same counts, tests, report and result as checkLocation,
+         with the visited set as bits, a cell index of OFF_BOARD is out
+         of bounds and the entry direction is given by the move
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           pointer to bitboard (const BitboardType *),
+                           pointer to visited bits (uint64_t *),
+                           recursion level for reporting (int),
+                           x and y indices (int), cell index (int),
+                           direction cell was entered (EntryDirections),
+                           pointer to working total (int *)
+Function Output/Parameters: pointer to search data (SearchContextType *),
+                            pointer to visited bits (uint64_t *),
+                            pointer to working total (int *)
+Function Output/Returned: result of test (ControlCodes)
+Device Input/---: none
+Device Output/monitor: status of cell attempt
+Dependencies: getTraceCell, displayStatus, isSumReachable
+*/
+ControlCodes checkBitboardLocation( SearchContextType *searchData,
+                          const BitboardType *bitboard, uint64_t *visited,
+                          int recLevel, int xIndex, int yIndex, int cellIndex,
+                          EntryDirections entryDirection, int *runningTotal )
+   {
+    int totalBefore = *runningTotal, value;
+    bool verbose = searchData->verbose;
+    uint64_t cellBit;
+
+    searchData->iterationCount++;
+
+    if( recLevel > searchData->peakDepth )
+       {
+        searchData->peakDepth = recLevel;
+       }
+
+    TRACE_STATUS( recLevel, "Trying Location: ",
+              getTraceCell( 0, xIndex, yIndex ), TEST_LOCATION, verbose );
+
+    if( cellIndex == OFF_BOARD )
+       {
+        TRACE_STATUS( recLevel, "Location failed: ",
+              getTraceCell( 0, xIndex, yIndex ), OUT_OF_BOUNDS, verbose );
+
+        return OUT_OF_BOUNDS;
+       }
+
+    value = bitboard->values[ cellIndex ];
+
+    *runningTotal += value;
+
+    if( *runningTotal > searchData->sumRequest )
+       {
+        TRACE_STATUS( recLevel, "Location failed: ",
+               getTraceCell( value, xIndex, yIndex ), OVER_SUM, verbose );
+
+        return OVER_SUM;
+       }
+
+    cellBit = (uint64_t)1 << cellIndex;
+
+    if( *visited & cellBit )
+       {
+        TRACE_STATUS( recLevel, "Location failed: ",
+         getTraceCell( value, xIndex, yIndex ), DUPLICATE_ITEM, verbose );
+
+        return DUPLICATE_ITEM;
+       }
+
+    *visited |= cellBit;
+
+    TRACE_STATUS( recLevel, "Valid Location found:",
+             getTraceCell( value, xIndex, yIndex ), VALID_ITEM, verbose );
+
+    if( *runningTotal == searchData->sumRequest )
+       {
+        if( xIndex == bitboard->rowSize - 1 )
+           {
+            return SOLUTION_FOUND;
+           }
+
+        *visited &= ~cellBit;
+
+        TRACE_STATUS( recLevel, "Location failed: ",
+            getTraceCell( value, xIndex, yIndex ), NO_SOLUTION, verbose );
+
+        return NO_SOLUTION;
+       }
+
+    if( searchData->pruneTable != NULL
+          && !isSumReachable( searchData->pruneTable, xIndex, yIndex,
+                 entryDirection, totalBefore, searchData->sumRequest ) )
+       {
+        searchData->prunedCount++;
+
+        TRACE_STATUS( recLevel, "Location pruned: ",
+          getTraceCell( value, xIndex, yIndex ), PRUNED_BRANCH, verbose );
+
+        return PRUNED_BRANCH;
+       }
+
+    return VALID_ITEM;
+   }
+
+/*
+Name: findSumBitboard
+Process: same search, report, counts and first solution as
+         findSumIterative for grids of at most BITBOARD_CELLS cells,
+         with the visited set in one uint64_t, moves found by a mask
+         test and an index step, and a fixed frame stack, then adds
+         the path to the set; searches without a visitor or
+         cancellation, falls back to findSumIterative for larger grids
+Function Input/Parameters: pointer to search data (SearchContextType *)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/monitor: operation of backtracking
+Dependencies: initializeBitboard, checkBitboardLocation, getTraceCell,
+              displayStatus, setCellData, addItem, findSumIterative
+*/
+bool findSumBitboard( SearchContextType *searchData )
+   {
+    const int rowMoves[ SEARCH_MOVES ] = {  0, 1,  0 };
+    const int colMoves[ SEARCH_MOVES ] = {  1, 0, -1 };
+    const EntryDirections moveDirections[ SEARCH_MOVES ]
+                                = { MOVING_RIGHT, FROM_ABOVE, MOVING_LEFT };
+    int frameCount = 0, runningTotal = 0, xIndex = 0, yIndex = 0;
+    int cellIndex = 0, move, index;
+    uint64_t visited = 0;
+    BitboardType bitboard;
+    BitboardFrameType frames[ BITBOARD_CELLS ], *topFrame;
+    CellDataType current;
+    ControlCodes locationResult;
+    bool found = false, verbose = searchData->verbose;
+
+    if( !initializeBitboard( &bitboard, searchData->dataArray ) )
+       {
+        return findSumIterative( searchData );
+       }
+
+    locationResult = checkBitboardLocation( searchData, &bitboard, &visited,
+                      1, xIndex, yIndex, cellIndex, FROM_ABOVE, &runningTotal );
+
+    while( !found )
+       {
+        // valid item, push frame and continue from it,
+        // pruned item is pushed with no directions left to try
+        if( locationResult == VALID_ITEM || locationResult == PRUNED_BRANCH )
+           {
+            topFrame = &frames[ frameCount ];
+
+            topFrame->rowIndex = xIndex;
+            topFrame->colIndex = yIndex;
+            topFrame->cellIndex = cellIndex;
+            topFrame->runningTotal = runningTotal;
+            topFrame->nextMove
+                     = locationResult == PRUNED_BRANCH ? SEARCH_MOVES : 0;
+
+            frameCount++;
+           }
+
+        // solution found, report each frame as the recursion would unwind
+        else if( locationResult == SOLUTION_FOUND )
+           {
+            for( index = frameCount - 1; index >= 0; index-- )
+               {
+                TRACE_STATUS( index + 1, "Valid Location found:",
+                    getTraceCell( bitboard.values[ frames[ index ].cellIndex ],
+                         frames[ index ].rowIndex, frames[ index ].colIndex ),
+                                                       VALID_ITEM, verbose );
+               }
+
+            found = true;
+           }
+
+        // failed with no frame left to continue from, search is over
+        else if( frameCount == 0 )
+           {
+            break;
+           }
+
+        if( !found )
+           {
+            topFrame = &frames[ frameCount - 1 ];
+
+            // try next direction from top frame, off the grid if the
+            // frame's cell is on the edge this move leaves
+            if( topFrame->nextMove < SEARCH_MOVES )
+               {
+                move = topFrame->nextMove;
+
+                runningTotal = topFrame->runningTotal;
+                xIndex = topFrame->rowIndex + rowMoves[ move ];
+                yIndex = topFrame->colIndex + colMoves[ move ];
+
+                cellIndex = ( bitboard.edgeMasks[ move ]
+                                           >> topFrame->cellIndex ) & 1
+                  ? OFF_BOARD : topFrame->cellIndex + bitboard.moveSteps[ move ];
+
+                locationResult = checkBitboardLocation( searchData,
+                        &bitboard, &visited, frameCount + 1, xIndex, yIndex,
+                        cellIndex, moveDirections[ move ], &runningTotal );
+
+                topFrame->nextMove++;
+               }
+
+            // all directions failed, backtrack
+            else
+               {
+                visited &= ~( (uint64_t)1 << topFrame->cellIndex );
+
+                frameCount--;
+
+                // start over from next top row location
+                if( frameCount == 0 && searchData->restartTopRow
+                      && topFrame->colIndex < bitboard.colSize )
+                   {
+                    runningTotal = 0;
+                    xIndex = 0;
+                    yIndex = topFrame->colIndex + 1;
+
+                    cellIndex = yIndex < bitboard.colSize ? yIndex : OFF_BOARD;
+
+                    locationResult = checkBitboardLocation( searchData,
+                           &bitboard, &visited, 1, xIndex, yIndex,
+                                       cellIndex, FROM_ABOVE, &runningTotal );
+                   }
+
+                else
+                   {
+                    TRACE_STATUS( frameCount + 1, "Location failed: ",
+                       getTraceCell( bitboard.values[ topFrame->cellIndex ],
+                               topFrame->rowIndex, topFrame->colIndex ),
+                                                      NO_SOLUTION, verbose );
+
+                    locationResult = NO_SOLUTION;
+                   }
+               }
+           }
+       }
+
+    // path is the frames and then the solution cell
+    if( found )
+       {
+        for( index = 0; found && index < frameCount; index++ )
+           {
+            setCellData( &current, 
+                      bitboard.values[ frames[ index ].cellIndex ],
+                      frames[ index ].rowIndex, frames[ index ].colIndex );
+
+            found = addItem( searchData->foundSet, current );
+           }
+
+        setCellData( &current, bitboard.values[ cellIndex ], xIndex, yIndex );
+
+        found = found && addItem( searchData->foundSet, current );
+       }
+
+    return found;
+   }
+
+/*
+Name: initializeBitboard
+Process: copies grid values and sets the edge masks and index steps,
+         returns true if successful, false if the grid is empty
+         or has more than BITBOARD_CELLS cells
+Function Input/Parameters: pointer to data array (const ArrayType *)
+Function Output/Parameters: pointer to bitboard (BitboardType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: isBitboardGrid, getArrayValue
+*/
+bool initializeBitboard( BitboardType *bitboard, const ArrayType *dataArray )
+   {
+    int rowIndex, colIndex, cellIndex;
+    uint64_t cellBit;
+
+    if( !isBitboardGrid( dataArray ) )
+       {
+        return false;
+       }
+
+    bitboard->rowSize = dataArray->rowSize;
+    bitboard->colSize = dataArray->colSize;
+
+    // right, down, left as in the search move order
+    bitboard->moveSteps[ 0 ] = 1;
+    bitboard->moveSteps[ 1 ] = dataArray->colSize;
+    bitboard->moveSteps[ 2 ] = -1;
+
+    bitboard->edgeMasks[ 0 ] = 0;
+    bitboard->edgeMasks[ 1 ] = 0;
+    bitboard->edgeMasks[ 2 ] = 0;
+
+    for( rowIndex = 0; rowIndex < dataArray->rowSize; rowIndex++ )
+       {
+        for( colIndex = 0; colIndex < dataArray->colSize; colIndex++ )
+           {
+            cellIndex = rowIndex * dataArray->colSize + colIndex;
+            cellBit = (uint64_t)1 << cellIndex;
+
+            bitboard->values[ cellIndex ]
+                           = getArrayValue( dataArray, rowIndex, colIndex );
+
+            if( colIndex == dataArray->colSize - 1 )
+               {
+                bitboard->edgeMasks[ 0 ] |= cellBit;
+               }
+
+            if( rowIndex == dataArray->rowSize - 1 )
+               {
+                bitboard->edgeMasks[ 1 ] |= cellBit;
+               }
+
+            if( colIndex == 0 )
+               {
+                bitboard->edgeMasks[ 2 ] |= cellBit;
+               }
+           }
+       }
+
+    return true;
+   }
+
+/*
+Name: isBitboardGrid
+Process: returns true if grid has from 1 to BITBOARD_CELLS cells,
+         false otherwise
+Function Input/Parameters: pointer to data array (const ArrayType *)
+Function Output/Parameters: none
+Function Output/Returned: result of test (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+bool isBitboardGrid( const ArrayType *dataArray )
+   {
+    long long cellCount = (long long)dataArray->rowSize * dataArray->colSize;
+
+    return dataArray->rowSize > 0 && dataArray->colSize > 0
+                                           && cellCount <= BITBOARD_CELLS;
+   }
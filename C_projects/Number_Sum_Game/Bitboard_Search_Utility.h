@@ -0,0 +1,109 @@
+#ifndef BITBOARD_SEARCH_UTILITY_H
+#define BITBOARD_SEARCH_UTILITY_H
+
+// included headers
+#include "RB_Utility.h"
+
+// local constants
+typedef enum { BITBOARD_CELLS = 64, OFF_BOARD = -1 } BitboardData;
+
+// small grid held for the bitboard search, a cell is bit
+// row * colSize + column of a uint64_t; values row-major, and for each
+// move right, down, left, the cells it would leave the grid from
+// and the index step it adds
+typedef struct BitboardStruct
+   {
+    int values[ BITBOARD_CELLS ];
+
+    uint64_t edgeMasks[ SEARCH_MOVES ];
+
+    int moveSteps[ SEARCH_MOVES ];
+
+    int rowSize, colSize;
+   } BitboardType;
+
+// one level of the bitboard search: cell row, column and bit index,
+// total including it, and next direction to try
+typedef struct BitboardFrameStruct
+   {
+    int rowIndex, colIndex, cellIndex;
+
+    int runningTotal;
+
+    int nextMove;
+   } BitboardFrameType;
+
+// prototypes
+
+/*
+Name: checkBitboardLocation
+Process: same counts, tests, report and result as checkLocation,
+         with the visited set as bits, a cell index of OFF_BOARD is out
+         of bounds and the entry direction is given by the move
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           pointer to bitboard (const BitboardType *),
+                           pointer to visited bits (uint64_t *),
+                           recursion level for reporting (int),
+                           x and y indices (int), cell index (int),
+                           direction cell was entered (EntryDirections),
+                           pointer to working total (int *)
+Function Output/Parameters: pointer to search data (SearchContextType *),
+                            pointer to visited bits (uint64_t *),
+                            pointer to working total (int *)
+Function Output/Returned: result of test (ControlCodes)
+Device Input/---: none
+Device Output/monitor: status of cell attempt
+Dependencies: getTraceCell, displayStatus, isSumReachable
+*/
+ControlCodes checkBitboardLocation( SearchContextType *searchData,
+                          const BitboardType *bitboard, uint64_t *visited,
+                          int recLevel, int xIndex, int yIndex, int cellIndex,
+                          EntryDirections entryDirection, int *runningTotal );
+
+/*
+Name: findSumBitboard
+Process: same search, report, counts and first solution as
+         findSumIterative for grids of at most BITBOARD_CELLS cells,
+         with the visited set in one uint64_t, moves found by a mask
+         test and an index step, and a fixed frame stack, then adds
+         the path to the set; searches without a visitor or
+         cancellation, falls back to findSumIterative for larger grids
+Function Input/Parameters: pointer to search data (SearchContextType *)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/monitor: operation of backtracking
+Dependencies: initializeBitboard, checkBitboardLocation, getTraceCell,
+              displayStatus, setCellData, addItem, findSumIterative
+*/
+bool findSumBitboard( SearchContextType *searchData );
+
+/*
+Name: initializeBitboard
+Process: copies grid values and sets the edge masks and index steps,
+         returns true if successful, false if the grid is empty
+         or has more than BITBOARD_CELLS cells
+Function Input/Parameters: pointer to data array (const ArrayType *)
+Function Output/Parameters: pointer to bitboard (BitboardType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: isBitboardGrid, getArrayValue
+*/
+bool initializeBitboard( BitboardType *bitboard, const ArrayType *dataArray );
+
+/*
+Name: isBitboardGrid
+Process: returns true if grid has from 1 to BITBOARD_CELLS cells,
+         false otherwise
+Function Input/Parameters: pointer to data array (const ArrayType *)
+Function Output/Parameters: none
+Function Output/Returned: result of test (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+bool isBitboardGrid( const ArrayType *dataArray );
+
+#endif  // BITBOARD_SEARCH_UTILITY_H
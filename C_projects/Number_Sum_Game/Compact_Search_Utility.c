@@ -0,0 +1,586 @@
+// included headers
+#include "Compact_Search_Utility.h"
+
+/*
+Name: getPathCell
+Process: returns cell of a path entry, with its location found from
+         the row-major index and its value read from the compact grid
+Function Input/Parameters: pointer to compact grid (const CompactGridType *),
+                           path entry (uint32_t)
+Function Output/Parameters: none
+Function Output/Returned: cell (CellDataType)
+Device Input/---: none
+Device Output/---: none
+Dependencies: setCellData, getCompactValue
+*/
+static CellDataType getPathCell( const CompactGridType *compactGrid,
+                                                       uint32_t pathEntry )
+   {
+    uint32_t cellIndex = pathEntry >> COMPACT_MOVE_BITS;
+    int rowIndex = (int)( cellIndex / compactGrid->colSize );
+    int colIndex = (int)( cellIndex % compactGrid->colSize );
+    CellDataType current;
+
+    setCellData( &current, getCompactValue( compactGrid, rowIndex, colIndex ),
+                                                       rowIndex, colIndex );
+
+    return current;
+   }
+
+/*
+Name: getTraceCell
+Process: returns cell with given value and location for reporting
+Function Input/Parameters: value, x and y indices (int)
+Function Output/Parameters: none
+Function Output/Returned: cell (CellDataType)
+Device Input/---: none
+Device Output/---: none
+Dependencies: setCellData
+*/
+static CellDataType getTraceCell( int value, int xIndex, int yIndex )
+   {
+    CellDataType current;
+
+    setCellData( &current, value, xIndex, yIndex );
+
+    return current;
+   }
+
+/*
+Name: checkCompactLocation
+Process: same counts, tests, report and result as checkLocation,
+         with values read from the compact grid and the visited set
+         as one bit per row-major cell index
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           pointer to compact grid (const CompactGridType *),
+                           visited bits (uint64_t *),
+                           recursion level for reporting (int),
+                           x and y indices (int),
+                           direction cell was entered (EntryDirections),
+                           pointer to working total (int *)
+Function Output/Parameters: pointer to search data (SearchContextType *),
+                            visited bits (uint64_t *),
+                            pointer to working total (int *)
+Function Output/Returned: result of test (ControlCodes)
+Device Input/---: none
+Device Output/monitor: status of cell attempt
+Dependencies: getTraceCell, displayStatus, isInBounds, getCompactValue,
+              isSumReachable
+*/
+ControlCodes checkCompactLocation( SearchContextType *searchData,
+                          const CompactGridType *compactGrid, uint64_t *visited,
+                          int recLevel, int xIndex, int yIndex,
+                          EntryDirections entryDirection, int *runningTotal )
+   {
+    int totalBefore = *runningTotal, value;
+    bool verbose = searchData->verbose;
+    size_t cellIndex;
+    uint64_t cellBit;
+
+    searchData->iterationCount++;
+
+    if( recLevel > searchData->peakDepth )
+       {
+        searchData->peakDepth = recLevel;
+       }
+
+    TRACE_STATUS( recLevel, "Trying Location: ",
+              getTraceCell( 0, xIndex, yIndex ), TEST_LOCATION, verbose );
+
+    if( !isInBounds( searchData->dataArray, xIndex, yIndex ) )
+       {
+        TRACE_STATUS( recLevel, "Location failed: ",
+              getTraceCell( 0, xIndex, yIndex ), OUT_OF_BOUNDS, verbose );
+
+        return OUT_OF_BOUNDS;
+       }
+
+    value = getCompactValue( compactGrid, xIndex, yIndex );
+
+    *runningTotal += value;
+
+    if( *runningTotal > searchData->sumRequest )
+       {
+        TRACE_STATUS( recLevel, "Location failed: ",
+               getTraceCell( value, xIndex, yIndex ), OVER_SUM, verbose );
+
+        return OVER_SUM;
+       }
+
+    cellIndex = (size_t)xIndex * compactGrid->colSize + yIndex;
+    cellBit = (uint64_t)1 << ( cellIndex % VISITED_WORD_BITS );
+
+    if( visited[ cellIndex / VISITED_WORD_BITS ] & cellBit )
+       {
+        TRACE_STATUS( recLevel, "Location failed: ",
+         getTraceCell( value, xIndex, yIndex ), DUPLICATE_ITEM, verbose );
+
+        return DUPLICATE_ITEM;
+       }
+
+    visited[ cellIndex / VISITED_WORD_BITS ] |= cellBit;
+
+    TRACE_STATUS( recLevel, "Valid Location found:",
+             getTraceCell( value, xIndex, yIndex ), VALID_ITEM, verbose );
+
+    if( *runningTotal == searchData->sumRequest )
+       {
+        if( xIndex == compactGrid->rowSize - 1 )
+           {
+            return SOLUTION_FOUND;
+           }
+
+        visited[ cellIndex / VISITED_WORD_BITS ] &= ~cellBit;
+
+        TRACE_STATUS( recLevel, "Location failed: ",
+            getTraceCell( value, xIndex, yIndex ), NO_SOLUTION, verbose );
+
+        return NO_SOLUTION;
+       }
+
+    if( searchData->pruneTable != NULL
+          && !isSumReachable( searchData->pruneTable, xIndex, yIndex,
+                 entryDirection, totalBefore, searchData->sumRequest ) )
+       {
+        searchData->prunedCount++;
+
+        TRACE_STATUS( recLevel, "Location pruned: ",
+          getTraceCell( value, xIndex, yIndex ), PRUNED_BRANCH, verbose );
+
+        return PRUNED_BRANCH;
+       }
+
+    return VALID_ITEM;
+   }
+
+/*
+Name: clearCompactGrid
+Process: releases heap memory held by compact grid, resets sizes to zero,
+         safe to call on a grid that was never allocated
+Function Input/Parameters: pointer to compact grid (CompactGridType *)
+Function Output/Parameters: pointer to compact grid (CompactGridType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearCompactGrid( CompactGridType *compactGrid )
+   {
+    free( compactGrid->cells );
+
+    compactGrid->cells = NULL;
+
+    compactGrid->rowSize = compactGrid->colSize = compactGrid->tileCols = 0;
+   }
+
+/*
+Name: clearCompactStack
+Process: releases heap memory held by compact frame stack,
+         resets size and capacity to zero
+Function Input/Parameters: pointer to frame stack (CompactStackType *)
+Function Output/Parameters: pointer to frame stack (CompactStackType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearCompactStack( CompactStackType *compactStack )
+   {
+    free( compactStack->frames );
+
+    compactStack->frames = NULL;
+
+    compactStack->size = compactStack->capacity = 0;
+   }
+
+/*
+Name: findSumCompact
+Process: same search, report, counts and first solution as
+         findSumIterative, reading 16 bit values from a compact grid,
+         with 8 byte frames holding a packed path entry and a total,
+         a one bit per cell visited set, and cell coordinates kept
+         only for the top frame; cell values are looked up again
+         when the path is added to the set once found;
+         a compact grid given in the search data is used as is,
+         otherwise a row-major one is built for this search;
+         searches without a visitor or cancellation, falls back to
+         findSumIterative if the grid does not fit 16 bit values or
+         memory cannot be allocated
+Function Input/Parameters: pointer to search data (SearchContextType *)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/monitor: operation of backtracking
+Dependencies: initializeCompactGrid, calloc, initializeCompactStack,
+              checkCompactLocation, pushCompactFrame, getPathCell,
+              displayStatus, setCellData, getCompactValue, addItem,
+              free, clearCompactStack, clearCompactGrid, findSumIterative
+*/
+bool findSumCompact( SearchContextType *searchData )
+   {
+    const int rowMoves[ SEARCH_MOVES ] = {  0, 1,  0 };
+    const int colMoves[ SEARCH_MOVES ] = {  1, 0, -1 };
+    const EntryDirections moveDirections[ SEARCH_MOVES ]
+                                = { MOVING_RIGHT, FROM_ABOVE, MOVING_LEFT };
+    const ArrayType *dataArray = searchData->dataArray;
+    const CompactGridType *compactGrid = searchData->compactGrid;
+    CompactGridType localGrid = { NULL, 0, 0, 0 };
+    CompactStackType compactStack = { NULL, 0, 0 };
+    CompactFrameType *topFrame;
+    int runningTotal = 0, xIndex = 0, yIndex = 0, topRow = 0, topCol = 0;
+    int move, index;
+    uint32_t cellIndex;
+    uint64_t *visited = NULL;
+    CellDataType current;
+    ControlCodes locationResult;
+    bool found = false, verbose = searchData->verbose;
+
+    if( compactGrid == NULL
+          && initializeCompactGrid( &localGrid, dataArray, false ) )
+       {
+        compactGrid = &localGrid;
+       }
+
+    if( compactGrid != NULL )
+       {
+        visited = calloc( ( (size_t)dataArray->rowSize * dataArray->colSize
+                            + VISITED_WORD_BITS - 1 ) / VISITED_WORD_BITS,
+                                                      sizeof( uint64_t ) );
+       }
+
+    if( visited == NULL || !initializeCompactStack( &compactStack ) )
+       {
+        free( visited );
+
+        clearCompactGrid( &localGrid );
+
+        return findSumIterative( searchData );
+       }
+
+    locationResult = checkCompactLocation( searchData, compactGrid, visited,
+                               1, xIndex, yIndex, FROM_ABOVE, &runningTotal );
+
+    while( !found )
+       {
+        // valid item, push frame and continue from it,
+        // pruned item is pushed with no directions left to try
+        if( locationResult == VALID_ITEM || locationResult == PRUNED_BRANCH )
+           {
+            cellIndex = (uint32_t)xIndex * dataArray->colSize + yIndex;
+
+            if( !pushCompactFrame( &compactStack,
+                   ( cellIndex << COMPACT_MOVE_BITS )
+                     | ( locationResult == PRUNED_BRANCH ? SEARCH_MOVES : 0 ),
+                                                           runningTotal ) )
+               {
+                break;
+               }
+
+            topRow = xIndex;
+            topCol = yIndex;
+           }
+
+        // solution found, report each frame as the recursion would unwind
+        else if( locationResult == SOLUTION_FOUND )
+           {
+            for( index = compactStack.size - 1; index >= 0; index-- )
+               {
+                TRACE_STATUS( index + 1, "Valid Location found:",
+                    getPathCell( compactGrid,
+                          compactStack.frames[ index ].pathEntry ),
+                                                       VALID_ITEM, verbose );
+               }
+
+            found = true;
+           }
+
+        // failed with no frame left to continue from, search is over
+        else if( compactStack.size == 0 )
+           {
+            break;
+           }
+
+        if( !found )
+           {
+            topFrame = &compactStack.frames[ compactStack.size - 1 ];
+
+            move = (int)( topFrame->pathEntry & COMPACT_MOVE_MASK );
+
+            // try next direction from top frame
+            if( move < SEARCH_MOVES )
+               {
+                runningTotal = topFrame->runningTotal;
+                xIndex = topRow + rowMoves[ move ];
+                yIndex = topCol + colMoves[ move ];
+
+                locationResult = checkCompactLocation( searchData,
+                           compactGrid, visited, compactStack.size + 1,
+                           xIndex, yIndex, moveDirections[ move ],
+                                                           &runningTotal );
+
+                topFrame->pathEntry++;
+               }
+
+            // all directions failed, backtrack
+            else
+               {
+                cellIndex = topFrame->pathEntry >> COMPACT_MOVE_BITS;
+
+                visited[ cellIndex / VISITED_WORD_BITS ]
+                         &= ~( (uint64_t)1 << ( cellIndex % VISITED_WORD_BITS ) );
+
+                compactStack.size--;
+
+                // start over from next top row location
+                if( compactStack.size == 0 && searchData->restartTopRow
+                      && topCol < dataArray->colSize )
+                   {
+                    runningTotal = 0;
+                    xIndex = 0;
+                    yIndex = topCol + 1;
+
+                    locationResult = checkCompactLocation( searchData,
+                                 compactGrid, visited, 1, xIndex, yIndex,
+                                                FROM_ABOVE, &runningTotal );
+                   }
+
+                else
+                   {
+                    TRACE_STATUS( compactStack.size + 1, "Location failed: ",
+                        getPathCell( compactGrid, topFrame->pathEntry ),
+                                                      NO_SOLUTION, verbose );
+
+                    locationResult = NO_SOLUTION;
+
+                    // new top cell is the one the popped cell was moved
+                    // to from, by the direction before its next one
+                    if( compactStack.size > 0 )
+                       {
+                        move = (int)( compactStack.frames[
+                           compactStack.size - 1 ].pathEntry
+                                                  & COMPACT_MOVE_MASK ) - 1;
+
+                        topRow -= rowMoves[ move ];
+                        topCol -= colMoves[ move ];
+                       }
+                   }
+               }
+           }
+       }
+
+    // path is the frames and then the solution cell
+    if( found )
+       {
+        for( index = 0; found && index < compactStack.size; index++ )
+           {
+            found = addItem( searchData->foundSet, getPathCell( compactGrid,
+                                   compactStack.frames[ index ].pathEntry ) );
+           }
+
+        setCellData( &current, getCompactValue( compactGrid, xIndex, yIndex ),
+                                                           xIndex, yIndex );
+
+        found = found && addItem( searchData->foundSet, current );
+       }
+
+    free( visited );
+
+    clearCompactStack( &compactStack );
+
+    clearCompactGrid( &localGrid );
+
+    return found;
+   }
+
+/*
+Name: getCompactValue
+Process: returns value stored at given row and column of compact grid,
+         indices are assumed to be in bounds
+Function Input/Parameters: pointer to compact grid (const CompactGridType *),
+                           row and column indices (int)
+Function Output/Parameters: none
+Function Output/Returned: value at location (int)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+int getCompactValue( const CompactGridType *compactGrid,
+                                               int rowIndex, int colIndex )
+   {
+    size_t tileIndex;
+
+    if( compactGrid->tileCols == 0 )
+       {
+        return compactGrid->cells[ (size_t)rowIndex * compactGrid->colSize
+                                                               + colIndex ];
+       }
+
+    tileIndex = (size_t)( rowIndex >> COMPACT_TILE_SHIFT )
+                  * compactGrid->tileCols + ( colIndex >> COMPACT_TILE_SHIFT );
+
+    return compactGrid->cells[ ( tileIndex << ( 2 * COMPACT_TILE_SHIFT ) )
+         + ( ( rowIndex & ( COMPACT_TILE_SIZE - 1 ) ) << COMPACT_TILE_SHIFT )
+                              + ( colIndex & ( COMPACT_TILE_SIZE - 1 ) ) ];
+   }
+
+/*
+Name: initializeCompactGrid
+Process: allocates compact grid, row-major or tiled, and copies
+         the data array values into it, unused cells of partial tiles
+         are zero, returns true if successful, false if the grid is empty,
+         has more than COMPACT_MAX_CELLS cells, has a value outside
+         the 16 bit range, or cannot be allocated
+Function Input/Parameters: pointer to data array (const ArrayType *),
+                           tiled layout flag (bool)
+Function Output/Parameters: pointer to compact grid (CompactGridType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: calloc, getArrayValue, clearCompactGrid
+*/
+bool initializeCompactGrid( CompactGridType *compactGrid,
+                               const ArrayType *dataArray, bool tiledLayout )
+   {
+    int rowIndex, colIndex, value;
+    size_t cellCount = (size_t)dataArray->rowSize * dataArray->colSize;
+    size_t tileRows;
+
+    compactGrid->cells = NULL;
+    compactGrid->rowSize = dataArray->rowSize;
+    compactGrid->colSize = dataArray->colSize;
+    compactGrid->tileCols = 0;
+
+    if( dataArray->rowSize <= 0 || dataArray->colSize <= 0
+                                           || cellCount > COMPACT_MAX_CELLS )
+       {
+        return false;
+       }
+
+    if( tiledLayout )
+       {
+        tileRows = ( dataArray->rowSize + COMPACT_TILE_SIZE - 1 )
+                                                     >> COMPACT_TILE_SHIFT;
+        compactGrid->tileCols = ( dataArray->colSize + COMPACT_TILE_SIZE - 1 )
+                                                     >> COMPACT_TILE_SHIFT;
+
+        cellCount = ( tileRows * compactGrid->tileCols )
+                                             << ( 2 * COMPACT_TILE_SHIFT );
+       }
+
+    compactGrid->cells = calloc( cellCount, sizeof( int16_t ) );
+
+    if( compactGrid->cells == NULL )
+       {
+        clearCompactGrid( compactGrid );
+
+        return false;
+       }
+
+    for( rowIndex = 0; rowIndex < dataArray->rowSize; rowIndex++ )
+       {
+        for( colIndex = 0; colIndex < dataArray->colSize; colIndex++ )
+           {
+            value = getArrayValue( dataArray, rowIndex, colIndex );
+
+            if( value < INT16_MIN || value > INT16_MAX )
+               {
+                clearCompactGrid( compactGrid );
+
+                return false;
+               }
+
+            if( tiledLayout )
+               {
+                compactGrid->cells[ ( ( (size_t)( rowIndex
+                    >> COMPACT_TILE_SHIFT ) * compactGrid->tileCols
+                    + ( colIndex >> COMPACT_TILE_SHIFT ) )
+                                            << ( 2 * COMPACT_TILE_SHIFT ) )
+                  + ( ( rowIndex & ( COMPACT_TILE_SIZE - 1 ) )
+                                                     << COMPACT_TILE_SHIFT )
+                  + ( colIndex & ( COMPACT_TILE_SIZE - 1 ) ) ]
+                                                         = (int16_t)value;
+               }
+
+            else
+               {
+                compactGrid->cells[ (size_t)rowIndex * dataArray->colSize
+                                               + colIndex ] = (int16_t)value;
+               }
+           }
+       }
+
+    return true;
+   }
+
+/*
+Name: initializeCompactStack
+Process: allocates compact frame stack at its starting capacity,
+         returns true if successful, false otherwise
+Function Input/Parameters: none
+Function Output/Parameters: pointer to frame stack (CompactStackType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: malloc
+*/
+bool initializeCompactStack( CompactStackType *compactStack )
+   {
+    compactStack->size = 0;
+    compactStack->capacity = FRAME_STACK_START;
+
+    compactStack->frames
+           = malloc( compactStack->capacity * sizeof( CompactFrameType ) );
+
+    if( compactStack->frames == NULL )
+       {
+        compactStack->capacity = 0;
+
+        return false;
+       }
+
+    return true;
+   }
+
+/*
+Name: pushCompactFrame
+Process: adds frame to top of compact stack, doubling capacity when full,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to frame stack (CompactStackType *),
+                           path entry (uint32_t),
+                           total including cell (int)
+Function Output/Parameters: pointer to frame stack (CompactStackType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: realloc
+*/
+bool pushCompactFrame( CompactStackType *compactStack,
+                                       uint32_t pathEntry, int runningTotal )
+   {
+    CompactFrameType *newFrames, *topFrame;
+
+    if( compactStack->size == compactStack->capacity )
+       {
+        newFrames = realloc( compactStack->frames,
+             2 * (size_t)compactStack->capacity * sizeof( CompactFrameType ) );
+
+        if( newFrames == NULL )
+           {
+            return false;
+           }
+
+        compactStack->frames = newFrames;
+
+        compactStack->capacity *= 2;
+       }
+
+    topFrame = &compactStack->frames[ compactStack->size ];
+
+    topFrame->pathEntry = pathEntry;
+    topFrame->runningTotal = runningTotal;
+
+    compactStack->size++;
+
+    return true;
+   }
@@ -0,0 +1,187 @@
+#ifndef COMPACT_SEARCH_UTILITY_H
+#define COMPACT_SEARCH_UTILITY_H
+
+// included headers
+#include "RB_Utility.h"
+
+// local constants
+typedef enum { COMPACT_TILE_SHIFT = 3, COMPACT_TILE_SIZE = 8,
+               COMPACT_MOVE_BITS = 2, COMPACT_MOVE_MASK = 3,
+               COMPACT_MAX_CELLS = 1 << 30 } CompactData;
+
+// grid held as 16 bit values for the compact search; row-major like
+// ArrayType when tileCols is 0, otherwise in square tiles of
+// COMPACT_TILE_SIZE rows and columns, tileCols tiles to a tile row,
+// each tile row-major and stored whole, so a move down stays
+// within the tile's few cache lines
+typedef struct CompactGridStruct
+   {
+    int16_t *cells;
+
+    int rowSize, colSize;
+
+    int tileCols;
+   } CompactGridType;
+
+// one level of the compact search: path entry is the cell's row-major
+// index shifted up COMPACT_MOVE_BITS, with the next direction to try
+// (0 right, 1 down, 2 left, SEARCH_MOVES done) in the low bits,
+// and total including the cell
+typedef struct CompactFrameStruct
+   {
+    uint32_t pathEntry;
+
+    int runningTotal;
+   } CompactFrameType;
+
+// heap allocated frame stack for the compact search
+typedef struct CompactStackStruct
+   {
+    CompactFrameType *frames;
+
+    int size, capacity;
+   } CompactStackType;
+
+// prototypes
+
+/*
+Name: checkCompactLocation
+Process: same counts, tests, report and result as checkLocation,
+         with values read from the compact grid and the visited set
+         as one bit per row-major cell index
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           pointer to compact grid (const CompactGridType *),
+                           visited bits (uint64_t *),
+                           recursion level for reporting (int),
+                           x and y indices (int),
+                           direction cell was entered (EntryDirections),
+                           pointer to working total (int *)
+Function Output/Parameters: pointer to search data (SearchContextType *),
+                            visited bits (uint64_t *),
+                            pointer to working total (int *)
+Function Output/Returned: result of test (ControlCodes)
+Device Input/---: none
+Device Output/monitor: status of cell attempt
+Dependencies: getTraceCell, displayStatus, isInBounds, getCompactValue,
+              isSumReachable
+*/
+ControlCodes checkCompactLocation( SearchContextType *searchData,
+                          const CompactGridType *compactGrid, uint64_t *visited,
+                          int recLevel, int xIndex, int yIndex,
+                          EntryDirections entryDirection, int *runningTotal );
+
+/*
+Name: clearCompactGrid
+Process: releases heap memory held by compact grid, resets sizes to zero,
+         safe to call on a grid that was never allocated
+Function Input/Parameters: pointer to compact grid (CompactGridType *)
+Function Output/Parameters: pointer to compact grid (CompactGridType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearCompactGrid( CompactGridType *compactGrid );
+
+/*
+Name: clearCompactStack
+Process: releases heap memory held by compact frame stack,
+         resets size and capacity to zero
+Function Input/Parameters: pointer to frame stack (CompactStackType *)
+Function Output/Parameters: pointer to frame stack (CompactStackType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearCompactStack( CompactStackType *compactStack );
+
+/*
+Name: findSumCompact
+Process: same search, report, counts and first solution as
+         findSumIterative, reading 16 bit values from a compact grid,
+         with 8 byte frames holding a packed path entry and a total,
+         a one bit per cell visited set, and cell coordinates kept
+         only for the top frame; cell values are looked up again
+         when the path is added to the set once found;
+         a compact grid given in the search data is used as is,
+         otherwise a row-major one is built for this search;
+         searches without a visitor or cancellation, falls back to
+         findSumIterative if the grid does not fit 16 bit values or
+         memory cannot be allocated
+Function Input/Parameters: pointer to search data (SearchContextType *)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/monitor: operation of backtracking
+Dependencies: initializeCompactGrid, calloc, initializeCompactStack,
+              checkCompactLocation, pushCompactFrame, getPathCell,
+              displayStatus, setCellData, getCompactValue, addItem,
+              free, clearCompactStack, clearCompactGrid, findSumIterative
+*/
+bool findSumCompact( SearchContextType *searchData );
+
+/*
+Name: getCompactValue
+Process: returns value stored at given row and column of compact grid,
+         indices are assumed to be in bounds
+Function Input/Parameters: pointer to compact grid (const CompactGridType *),
+                           row and column indices (int)
+Function Output/Parameters: none
+Function Output/Returned: value at location (int)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+int getCompactValue( const CompactGridType *compactGrid,
+                                               int rowIndex, int colIndex );
+
+/*
+Name: initializeCompactGrid
+Process: allocates compact grid, row-major or tiled, and copies
+         the data array values into it, unused cells of partial tiles
+         are zero, returns true if successful, false if the grid is empty,
+         has more than COMPACT_MAX_CELLS cells, has a value outside
+         the 16 bit range, or cannot be allocated
+Function Input/Parameters: pointer to data array (const ArrayType *),
+                           tiled layout flag (bool)
+Function Output/Parameters: pointer to compact grid (CompactGridType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: calloc, getArrayValue, clearCompactGrid
+*/
+bool initializeCompactGrid( CompactGridType *compactGrid,
+                               const ArrayType *dataArray, bool tiledLayout );
+
+/*
+Name: initializeCompactStack
+Process: allocates compact frame stack at its starting capacity,
+         returns true if successful, false otherwise
+Function Input/Parameters: none
+Function Output/Parameters: pointer to frame stack (CompactStackType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: malloc
+*/
+bool initializeCompactStack( CompactStackType *compactStack );
+
+/*
+Name: pushCompactFrame
+Process: adds frame to top of compact stack, doubling capacity when full,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to frame stack (CompactStackType *),
+                           path entry (uint32_t),
+                           total including cell (int)
+Function Output/Parameters: pointer to frame stack (CompactStackType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: realloc
+*/
+bool pushCompactFrame( CompactStackType *compactStack,
+                                       uint32_t pathEntry, int runningTotal );
+
+#endif  // COMPACT_SEARCH_UTILITY_H
@@ -45,25 +45,74 @@ UTILITY USAGE INSTRUCTIONS:
     // constant used for zero int/double value return
     static const char ZERO_VALUE = 0;
 
+    // input buffer sizes
+    typedef enum { INPUT_BUFFER_SIZE = 65536, 
+                   MIN_MAPPED_FILE_SIZE = 65536 } InputBufferData;
+
+// data structures
+
+    // block buffer or mapped file span between input file and readers,
+    // bytes points at data for stdio reading, or at the mapped span
+    typedef struct InputBufferStruct
+       {
+        char data[ INPUT_BUFFER_SIZE ];
+        const char *bytes;
+        size_t position;
+        size_t length;
+        size_t mapLength;
+       } InputBufferType;
+
+    // independent input reader, contents private to File_Input_Utility.c;
+    // created by openInputReader, released by closeInputReader
+    typedef struct InputReaderStruct InputReaderType;
+
 // function prototypes
 
+    /*
+    Name: accessDefaultInputReader
+    process: allows access to the input reader used by the 
+             global-style functions (openInputFile, readIntegerFromFile, etc.);
+             note: reader is maintained (static) value initialized closed
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: pointer to default reader (InputReaderType *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    InputReaderType *accessDefaultInputReader();
+
     /*
     Name: accessEndOfInputFileFlag
     process: allows accessing or modifying end of file flag state;
-             note: flag is maintained (static) value initialized to false
+             note: flag is kept in default input reader, initialized to false
     Function input/parameters: control code (int), flag state (bool)
     Function output/parameters: none
     Function output/returned: result of flag state (bool)
     Device input/file: none
     Device output/monitor: none
-    Dependencies: none
+    Dependencies: accessDefaultInputReader
     */
     bool accessEndOfInputFileFlag( int ctrlCode, bool setFlag );
 
+    /*
+    Name: accessInputBuffer
+    process: allows access to the block buffer or mapped file span 
+             between file and readers;
+             note: buffer is kept in default input reader, initialized empty
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: pointer to input buffer (InputBufferType *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: accessDefaultInputReader
+    */
+    InputBufferType *accessInputBuffer();
+
     /*
     Name: accessInputFilePointer
     process: allows setting or accessing file pointer;
-             note: pointer is maintained (static) value initialized to NULL
+             note: pointer is kept in default input reader, initialized to NULL
     Function input/parameters: control code (int), file pointer (FILE *)
                                DUMMY_INPUT_FILE_PTR used 
                                if not setting file pointer
@@ -71,7 +120,7 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: file pointer (FILE *)
     Device input/file: none
     Device output/monitor: none
-    Dependencies: none
+    Dependencies: accessDefaultInputReader
     */
     FILE *accessInputFilePointer( int ctrlCode, const FILE *filePtr );
 
@@ -101,6 +150,33 @@ UTILITY USAGE INSTRUCTIONS:
     */
     bool checkForInputFileOpen();
 
+    /*
+    Name: checkForReaderEndOfFile
+    process: checks to see if reader end of file flag has been encountered,
+             returns true if EOF has been encountered, false otherwise
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForReaderEndOfFile( const InputReaderType *reader );
+
+    /*
+    Name: checkForReaderOpen
+    process: checks to see if reader file is currently open
+             returns true if reader and its file pointer not null, 
+             false otherwise
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForReaderOpen( const InputReaderType *reader );
+
     /*
     Name: clearLeadingWhiteSpace
     process: captures non printable characters,
@@ -111,7 +187,7 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: first non WS character as integer
     Device input/file: value captured from file
     Device output/monitor: none
-    Dependencies: fgetc
+    Dependencies: accessInputBuffer, clearBufferWhiteSpace
     */
     int clearLeadingWhiteSpace( FILE *filePtr, bool clearSpace );
 
@@ -123,23 +199,148 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: none
     Device input/file: file closed
     Device output/monitor: none
-    Dependencies: accessInputFilePointer, fclose, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, closeReaderFile
     */
     bool closeInputFile();
 
+    /*
+    Name: closeInputReader
+    process: closes reader file if open, releases reader memory,
+             returns true if a file was closed, false otherwise
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: file closed
+    Device output/monitor: none
+    Dependencies: closeReaderFile, free
+    */
+    bool closeInputReader( InputReaderType *reader );
+
+    /*
+    Name: fillInputBuffer
+    process: moves unread bytes to the front of the buffer,
+             then reads a block from the file to fill the rest,
+             returns number of unread bytes now in the buffer, 
+             zero at end of file;
+             a mapped file span already holds the whole file, 
+             so nothing is read for it
+    Function input/parameters: pointer to input buffer (InputBufferType *),
+                               file pointer (FILE *)
+    Function output/parameters: pointer to input buffer (InputBufferType *)
+    Function output/returned: unread byte count (size_t)
+    Device input/file: block captured from file
+    Device output/monitor: none
+    Dependencies: memmove, fread
+    */
+    size_t fillInputBuffer( InputBufferType *inputBuffer, FILE *filePtr );
+
+    /*
+    Name: getInputChar
+    process: captures next byte through the input buffer,
+             refilling buffer from file when empty
+    Function input/parameters: pointer to input buffer (InputBufferType *),
+                               file pointer (FILE *)
+    Function output/parameters: pointer to input buffer (InputBufferType *)
+    Function output/returned: byte as unsigned char value, EOF at end of file
+    Device input/file: block captured from file as needed
+    Device output/monitor: none
+    Dependencies: fillInputBuffer
+    */
+    int getInputChar( InputBufferType *inputBuffer, FILE *filePtr );
+
+    /*
+    Name: getInputFileSpan
+    process: provides the unread part of a memory mapped input file 
+             as a read-only byte span, without copying;
+             returns NULL with zero length when the file is read 
+             through stdio (no file open, small file, or pipe)
+    Function input/parameters: none
+    Function output/parameters: span length in bytes (size_t *)
+    Function output/returned: pointer to first unread byte (const char *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: accessDefaultInputReader, getReaderSpan
+    */
+    const char *getInputFileSpan( size_t *spanLength );
+
+    /*
+    Name: getReaderSpan
+    process: provides the unread part of a reader memory mapped file 
+             as a read-only byte span, without copying;
+             returns NULL with zero length when the file is read 
+             through stdio (no file open, small file, or pipe)
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: span length in bytes (size_t *)
+    Function output/returned: pointer to first unread byte (const char *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    const char *getReaderSpan( const InputReaderType *reader, 
+                                                         size_t *spanLength );
+
+    /*
+    Name: mapInputFile
+    process: maps a newly opened regular file into memory as 
+             the read-only span behind the input buffer,
+             leaves the buffer reading through stdio for small files, 
+             pipes and other non regular files, if mapping fails,
+             or on platforms without POSIX file mapping,
+             returns true if file mapped, false otherwise
+    Function input/parameters: pointer to input buffer (InputBufferType *),
+                               file pointer (FILE *)
+    Function output/parameters: pointer to input buffer (InputBufferType *)
+    Function output/returned: success of mapping (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: fileno, fstat, mmap, posix_madvise
+    */
+    bool mapInputFile( InputBufferType *inputBuffer, FILE *filePtr );
+
    /*
     Name: openInputFile
     process: opens input file, sets file pointer and unsets end of file flag,
+             maps large regular files into memory for reading,
              returns true if successful, false otherwise
     Function input/parameters: file name (c-string)
     Function output/parameters: none
     Function output/returned: success of operation (bool)
     Device input/file: file opened
     Device output/monitor: none
-    Dependencies: fopen, accessInputFilePointer, accessEndOfInputFileFlag
+    Dependencies: checkForInputFileOpen, accessDefaultInputReader, 
+                  openReaderFile
     */
     bool openInputFile( const char *fileName );
-    
+
+    /*
+    Name: openInputReader
+    process: creates an independent input reader and opens the file in it;
+             readers share no state, so each may be used on its own thread,
+             returns reader if successful, NULL otherwise
+    Function input/parameters: file name (c-string)
+    Function output/parameters: none
+    Function output/returned: new reader (InputReaderType *), 
+                              release with closeInputReader
+    Device input/file: file opened
+    Device output/monitor: none
+    Dependencies: malloc, openReaderFile, free
+    */
+    InputReaderType *openInputReader( const char *fileName );
+
+    /*
+    Name: peekInputChar
+    process: returns next byte through the input buffer without consuming it,
+             refilling buffer from file when empty
+    Function input/parameters: pointer to input buffer (InputBufferType *),
+                               file pointer (FILE *)
+    Function output/parameters: pointer to input buffer (InputBufferType *)
+    Function output/returned: byte as unsigned char value, EOF at end of file
+    Device input/file: block captured from file as needed
+    Device output/monitor: none
+    Dependencies: fillInputBuffer
+    */
+    int peekInputChar( InputBufferType *inputBuffer, FILE *filePtr );
+
     /*
     Name: readCharacterFromFile
     process: ignores leading unprintable characters, including space,
@@ -163,12 +364,40 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: character found if successful, ZERO_CHAR otherwise
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, clearLeadingWhiteSpace, 
-                  accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readCharacterFromReaderConfigured
     */
     char readCharacterFromFileConfigured( bool captureSpace );
 
+    /*
+    Name: readCharacterFromReader
+    process: ignores leading unprintable characters, including space,
+             captures first printable character
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: character found if successful, ZERO_CHAR otherwise
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readCharacterFromReaderConfigured
+    */
+    char readCharacterFromReader( InputReaderType *reader );
+
+    /*
+    Name: readCharacterFromReaderConfigured
+    process: ignores leading unprintable characters,
+             captures first printable character,
+             including space if allowed
+    Function input/parameters: input reader (InputReaderType *),
+                               allow space capture (bool)
+    Function output/parameters: none
+    Function output/returned: character found if successful, ZERO_CHAR otherwise
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForReaderOpen, checkForReaderEndOfFile, 
+                  clearBufferWhiteSpace
+    */
+    char readCharacterFromReaderConfigured( InputReaderType *reader, 
+                                                           bool captureSpace );
+
     /*
     Name: readDoubleFromFile
     process: ignores leading unprintable characters,
@@ -178,11 +407,24 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: double value found if successful (double)
     Device input/file: double value captured from file
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fscanf, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readDoubleFromReader
     */
     double readDoubleFromFile();
-      
+
+    /*
+    Name: readDoubleFromReader
+    process: ignores leading unprintable characters,
+             captures first contiguous double value
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: double value found if successful (double)
+    Device input/file: double value captured from file
+    Device output/monitor: none
+    Dependencies: checkForReaderOpen, checkForReaderEndOfFile, 
+                  scanDoubleFromInput
+    */
+    double readDoubleFromReader( InputReaderType *reader );
+
     /*
     Name: readIntegerFromFile
     process: ignores leading unprintable characters,
@@ -192,11 +434,61 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: integer found if successful, ZERO_VALUE otherwise
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fscanf, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readIntegerFromReader
     */
     int readIntegerFromFile();
-      
+
+    /*
+    Name: readIntegerFromReader
+    process: ignores leading unprintable characters,
+             captures first contiguous integer
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: integer found if successful, ZERO_VALUE otherwise
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForReaderOpen, checkForReaderEndOfFile, 
+                  scanLongFromInput
+    */
+    int readIntegerFromReader( InputReaderType *reader );
+
+    /*
+    Name: readIntegersFromFile
+    process: ignores leading white space before each value,
+             captures up to the given number of contiguous integers 
+             into the array in one call, parsed straight from the input 
+             buffer; stops early at end of file, setting the end of file 
+             flag as readIntegerFromFile does, or at text that is not 
+             an integer, leaving it unread
+    Function input/parameters: number of values wanted (int)
+    Function output/parameters: values captured (int *)
+    Function output/returned: number of values captured (int)
+    Device input/file: values captured from file as needed
+    Device output/monitor: none
+    Dependencies: accessDefaultInputReader, readIntegersFromReader
+    */
+    int readIntegersFromFile( int *values, int valueCount );
+
+    /*
+    Name: readIntegersFromReader
+    process: ignores leading white space before each value,
+             captures up to the given number of contiguous integers 
+             into the array in one call, parsed straight from the input 
+             buffer; stops early at end of file, setting the end of file 
+             flag as readIntegerFromFile does, or at text that is not 
+             an integer, leaving it unread
+    Function input/parameters: input reader (InputReaderType *),
+                               number of values wanted (int)
+    Function output/parameters: values captured (int *)
+    Function output/returned: number of values captured (int)
+    Device input/file: values captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForReaderOpen, checkForReaderEndOfFile, 
+                  scanLongFromInput
+    */
+    int readIntegersFromReader( InputReaderType *reader, 
+                                                 int *values, int valueCount );
+
     /*
     Name: readLongFromFile
     process: ignores leading unprintable characters,
@@ -207,11 +499,25 @@ UTILITY USAGE INSTRUCTIONS:
                               ZERO_VALUE otherwise
     Device input/file: long value captured from file
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fscanf, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readLongFromReader
     */
     long readLongFromFile();
-      
+
+    /*
+    Name: readLongFromReader
+    process: ignores leading unprintable characters,
+             captures first contiguous long int
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: long integer found if successful, 
+                              ZERO_VALUE otherwise
+    Device input/file: long value captured from file
+    Device output/monitor: none
+    Dependencies: checkForReaderOpen, checkForReaderEndOfFile, 
+                  scanLongFromInput
+    */
+    long readLongFromReader( InputReaderType *reader );
+
     /*
     Name: readRawCharFromFile
     process: captures first character in file stream including non-printable
@@ -220,11 +526,23 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: character found if successful, ZERO_CHAR otherwise
     Device input/file: character captured from file
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fgetc, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readRawCharFromReader
     */
     char readRawCharFromFile();
 
+    /*
+    Name: readRawCharFromReader
+    process: captures first character in file stream including non-printable
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: character found if successful, ZERO_CHAR otherwise
+    Device input/file: character captured from file
+    Device output/monitor: none
+    Dependencies: checkForReaderOpen, checkForReaderEndOfFile, 
+                  getInputChar
+    */
+    char readRawCharFromReader( InputReaderType *reader );
+
     /*
     Name: readStringConfiguredFromFile
     Process: captures string with options:
@@ -241,8 +559,7 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: success of operation (bool)
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  clearLeadingWhiteSpace, fgetc, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readStringConfiguredFromReader
     */
    bool readStringConfiguredFromFile( bool clearLeadingNonPrintable, 
                                       bool clearLeadingSpace, 
@@ -250,6 +567,33 @@ UTILITY USAGE INSTRUCTIONS:
                                       char delimiter,
                                       char *capturedString );
 
+    /*
+    Name: readStringConfiguredFromReader
+    Process: captures string with options:
+             - clear leading non printable (bool)
+             - clear leading space character (bool)
+             - adquires characters up to any non-printable (bool)
+             - adquires characters up to any printable delimiter (char)
+               - use constant NON_PRINTABLE if no delimiter
+             - also stops capture when full (MAX_STR_LEN)
+             Note: This function consumes the last character input,
+             including the space, delimiter, or non-printable character
+    Function input/parameters: input reader (InputReaderType *),
+                               see process above
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: success of operation (bool)
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForReaderOpen, checkForReaderEndOfFile, 
+                  clearBufferWhiteSpace, getInputChar
+    */
+   bool readStringConfiguredFromReader( InputReaderType *reader,
+                                        bool clearLeadingNonPrintable, 
+                                        bool clearLeadingSpace, 
+                                        bool stopAtNonPrintable, 
+                                        char delimiter,
+                                        char *capturedString );
+
    /*
     Name: readStringSegmentFromFile
     process: ignores leading white space, including space character,
@@ -264,6 +608,21 @@ UTILITY USAGE INSTRUCTIONS:
     */
     bool readStringSegmentFromFile( char *capturedString );
 
+   /*
+    Name: readStringSegmentFromReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to first space,
+             or end of line, or full string
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: success of operation (bool)
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromReader with appropriate parameters
+    */
+    bool readStringSegmentFromReader( InputReaderType *reader, 
+                                     char *capturedString );
+
    /*
     Name: readStringToLineEndFromFile
     process: ignores leading white space, including space character,
@@ -278,6 +637,21 @@ UTILITY USAGE INSTRUCTIONS:
     */
     bool readStringToLineEndFromFile( char *capturedString );
 
+   /*
+    Name: readStringToLineEndFromReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to end of current line
+             or full string
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: string found if successful
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromReader with appropriate parameters
+    */
+    bool readStringToLineEndFromReader( InputReaderType *reader, 
+                                       char *capturedString );
+
    /*
     Name: readStringToDelimiterFromFile
     process: ignores leading white space, including space character,
@@ -291,4 +665,71 @@ UTILITY USAGE INSTRUCTIONS:
     */
     bool readStringToDelimiterFromFile( char delimiter, char *capturedString );
 
+   /*
+    Name: readStringToDelimiterFromReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to specified character
+    Function input/parameters: input reader (InputReaderType *),
+                               delimiter (char)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: string found if successful
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromReader with appropriate parameters
+    */
+    bool readStringToDelimiterFromReader( InputReaderType *reader, 
+                                          char delimiter, char *capturedString );
+
+    /*
+    Name: resetInputBuffer
+    process: releases any mapped file span, 
+             then empties the buffer for stdio reading
+    Function input/parameters: pointer to input buffer (InputBufferType *)
+    Function output/parameters: pointer to input buffer (InputBufferType *)
+    Function output/returned: none
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: munmap
+    */
+    void resetInputBuffer( InputBufferType *inputBuffer );
+
+    /*
+    Name: scanDoubleFromInput
+    process: ignores leading white space, then captures the characters
+             of a decimal value (digits, sign, point, exponent) straight
+             from the input buffer and converts them,
+             leaving the first other character unread
+    Function input/parameters: pointer to input buffer (InputBufferType *),
+                               file pointer (FILE *)
+    Function output/parameters: pointer to input buffer (InputBufferType *),
+                                double value found (double *)
+    Function output/returned: 1 if value found, 0 if other text found,
+                              EOF if end of file found first
+    Device input/file: characters captured from file as needed
+    Device output/monitor: none
+    Dependencies: peekInputChar, isspace, isdigit, strtod
+    */
+    int scanDoubleFromInput( InputBufferType *inputBuffer, FILE *filePtr,
+                                                           double *doubleVal );
+
+    /*
+    Name: scanLongFromInput
+    process: ignores leading white space, then captures an optional sign 
+             and digits with a digit loop straight over the input buffer
+             or mapped file span,
+             refilling it when a value runs past its end,
+             leaving the first character after the value unread
+    Function input/parameters: pointer to input buffer (InputBufferType *),
+                               file pointer (FILE *)
+    Function output/parameters: pointer to input buffer (InputBufferType *),
+                                long value found (long *)
+    Function output/returned: 1 if value found, 0 if other text found,
+                              EOF if end of file found first
+    Device input/file: blocks captured from file as needed
+    Device output/monitor: none
+    Dependencies: peekInputChar, isspace, fillInputBuffer
+    */
+    int scanLongFromInput( InputBufferType *inputBuffer, FILE *filePtr,
+                                                               long *longVal );
+
 #endif  // FILE_INPUT_UTILITY_H
@@ -0,0 +1,426 @@
+// included headers
+#include "Grid_File_Utility.h"
+
+// magic bytes opening every binary grid file
+static const char GRID_MAGIC[ GRID_MAGIC_SIZE ] = { 'N', 'S', 'G', 'B' };
+
+/*
+Name: getLittleEndian32
+Process: assembles an unsigned 32 bit value from four little-endian bytes
+Function Input/Parameters: first byte (const unsigned char *)
+Function Output/Parameters: none
+Function Output/Returned: assembled value (uint32_t)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+static uint32_t getLittleEndian32( const unsigned char *bytes )
+   {
+    return (uint32_t)bytes[ 0 ] | (uint32_t)bytes[ 1 ] << 8
+           | (uint32_t)bytes[ 2 ] << 16 | (uint32_t)bytes[ 3 ] << 24;
+   }
+
+/*
+Name: isLittleEndianHost
+Process: returns true if the host stores integers low byte first,
+         so cells can move between file and array unchanged
+Function Input/Parameters: none
+Function Output/Parameters: none
+Function Output/Returned: result of test (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+static bool isLittleEndianHost()
+   {
+    const uint32_t probe = 1;
+
+    return *(const unsigned char *)&probe == 1;
+   }
+
+/*
+Name: readFully
+Process: reads the requested number of bytes, continuing after partial
+         reads, returns true if all bytes were read, false otherwise
+Function Input/Parameters: file descriptor (int), byte count (size_t)
+Function Output/Parameters: bytes read (void *)
+Function Output/Returned: success of operation (bool)
+Device Input/HD: bytes read from file
+Device Output/---: none
+Dependencies: read
+*/
+static bool readFully( int fileDescriptor, void *bytes, size_t byteCount )
+   {
+    char *next = bytes;
+    ssize_t readCount;
+
+    while( byteCount > 0 )
+       {
+        readCount = read( fileDescriptor, next, byteCount );
+
+        if( readCount <= 0 )
+           {
+            return false;
+           }
+
+        next += readCount;
+        byteCount -= (size_t)readCount;
+       }
+
+    return true;
+   }
+
+/*
+Name: setLittleEndian32
+Process: stores an unsigned 32 bit value as four little-endian bytes
+Function Input/Parameters: value (uint32_t)
+Function Output/Parameters: first byte (unsigned char *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+static void setLittleEndian32( unsigned char *bytes, uint32_t value )
+   {
+    bytes[ 0 ] = (unsigned char)value;
+    bytes[ 1 ] = (unsigned char)( value >> 8 );
+    bytes[ 2 ] = (unsigned char)( value >> 16 );
+    bytes[ 3 ] = (unsigned char)( value >> 24 );
+   }
+
+/*
+Name: swapCellBytes
+Process: reverses the byte order of every cell in place,
+         converting between little-endian file order and a
+         big-endian host
+Function Input/Parameters: cells (int *), cell count (size_t)
+Function Output/Parameters: cells (int *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: getLittleEndian32
+*/
+static void swapCellBytes( int *cells, size_t cellCount )
+   {
+    size_t index;
+
+    for( index = 0; index < cellCount; index++ )
+       {
+        cells[ index ] = (int)getLittleEndian32(
+                                     (const unsigned char *)&cells[ index ] );
+       }
+   }
+
+/*
+Name: writeFully
+Process: writes the given bytes, continuing after partial writes,
+         returns true if all bytes were written, false otherwise
+Function Input/Parameters: file descriptor (int), bytes (const void *),
+                           byte count (size_t)
+Function Output/Parameters: none
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/HD: bytes written to file
+Dependencies: write
+*/
+static bool writeFully( int fileDescriptor, const void *bytes,
+                                                          size_t byteCount )
+   {
+    const char *next = bytes;
+    ssize_t writeCount;
+
+    while( byteCount > 0 )
+       {
+        writeCount = write( fileDescriptor, next, byteCount );
+
+        if( writeCount <= 0 )
+           {
+            return false;
+           }
+
+        next += writeCount;
+        byteCount -= (size_t)writeCount;
+       }
+
+    return true;
+   }
+
+/*
+Name: convertTextGrid
+Process: uploads a text grid file and saves it as a binary grid file,
+         returns true if both steps succeed, false otherwise
+Function Input/Parameters: text grid file name (const char *),
+                           binary grid file name (const char *)
+Function Output/Parameters: none
+Function Output/Returned: success of operation (bool)
+Device Input/HD: text grid input from file
+Device Output/HD: binary grid written to file
+Dependencies: uploadTextGrid, saveBinaryGrid, clearArray
+*/
+bool convertTextGrid( const char *textFileName, const char *binaryFileName )
+   {
+    ArrayType dataArray = { NULL, 0, 0 };
+    bool converted;
+
+    if( !uploadTextGrid( textFileName, &dataArray ) )
+       {
+        return false;
+       }
+
+    converted = saveBinaryGrid( binaryFileName, &dataArray );
+
+    clearArray( &dataArray );
+
+    return converted;
+   }
+
+/*
+Name: isBinaryGridFile
+Process: checks whether a file starts with the binary grid magic
+Function Input/Parameters: file name (const char *)
+Function Output/Parameters: none
+Function Output/Returned: result of test (bool)
+Device Input/HD: magic bytes read from file
+Device Output/---: none
+Dependencies: open, readFully, close, memcmp
+*/
+bool isBinaryGridFile( const char *fileName )
+   {
+    char magic[ GRID_MAGIC_SIZE ];
+    int fileDescriptor = open( fileName, O_RDONLY );
+    bool isBinary;
+
+    if( fileDescriptor < 0 )
+       {
+        return false;
+       }
+
+    isBinary = readFully( fileDescriptor, magic, GRID_MAGIC_SIZE )
+               && memcmp( magic, GRID_MAGIC, GRID_MAGIC_SIZE ) == 0;
+
+    close( fileDescriptor );
+
+    return isBinary;
+   }
+
+/*
+Name: loadBinaryGrid
+Process: reads and checks the binary grid header, sizes the array,
+         then reads every cell with one read straight into the array
+         storage, byte swapping only on big-endian hosts,
+         returns true if the whole grid loaded, false otherwise
+Function Input/Parameters: binary grid file name (const char *)
+Function Output/Parameters: data array (ArrayType *)
+Function Output/Returned: success of operation (bool)
+Device Input/HD: binary grid input from file
+Device Output/---: none
+Dependencies: open, fstat, readFully, getLittleEndian32, initializeArray,
+              swapCellBytes, clearArray, close, memcmp
+*/
+bool loadBinaryGrid( const char *fileName, ArrayType *dataArray )
+   {
+    unsigned char header[ GRID_HEADER_SIZE ];
+    uint32_t rowSize, colSize;
+    size_t cellCount;
+    struct stat fileStats;
+    bool loaded = false;
+    int fileDescriptor = open( fileName, O_RDONLY );
+
+    if( fileDescriptor < 0 )
+       {
+        return false;
+       }
+
+    // header must match this version and the file must hold every cell,
+    // so a truncated or foreign file is refused before allocating
+    if( fstat( fileDescriptor, &fileStats ) == 0
+        && readFully( fileDescriptor, header, GRID_HEADER_SIZE )
+        && memcmp( header, GRID_MAGIC, GRID_MAGIC_SIZE ) == 0
+        && ( header[ 4 ] | header[ 5 ] << 8 ) == GRID_FILE_VERSION
+        && ( header[ 6 ] | header[ 7 ] << 8 ) == GRID_CELL_WIDTH )
+       {
+        rowSize = getLittleEndian32( &header[ 8 ] );
+        colSize = getLittleEndian32( &header[ 12 ] );
+        cellCount = (size_t)rowSize * colSize;
+
+        if( rowSize <= INT_MAX && colSize <= INT_MAX
+            && ( colSize == 0 || cellCount / colSize == rowSize )
+            && (unsigned long long)fileStats.st_size
+                        == GRID_HEADER_SIZE
+                           + (unsigned long long)cellCount * GRID_CELL_WIDTH
+            && initializeArray( dataArray, (int)rowSize, (int)colSize ) )
+           {
+            loaded = readFully( fileDescriptor, dataArray->array,
+                                              cellCount * GRID_CELL_WIDTH );
+
+            if( loaded && !isLittleEndianHost() )
+               {
+                swapCellBytes( dataArray->array, cellCount );
+               }
+
+            if( !loaded )
+               {
+                clearArray( dataArray );
+               }
+           }
+       }
+
+    close( fileDescriptor );
+
+    return loaded;
+   }
+
+/*
+Name: saveBinaryGrid
+Process: writes the binary grid header and every cell,
+         the cells in one write on little-endian hosts,
+         returns true if the whole grid was written, false otherwise
+Function Input/Parameters: binary grid file name (const char *),
+                           data array (const ArrayType *)
+Function Output/Parameters: none
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/HD: binary grid written to file
+Dependencies: open, setLittleEndian32, writeFully, swapCellBytes, close
+*/
+bool saveBinaryGrid( const char *fileName, const ArrayType *dataArray )
+   {
+    unsigned char header[ GRID_HEADER_SIZE ];
+    size_t cellCount = (size_t)dataArray->rowSize * dataArray->colSize;
+    size_t index;
+    int cellBytes;
+    bool saved;
+    int fileDescriptor = open( fileName, O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+
+    if( fileDescriptor < 0 )
+       {
+        return false;
+       }
+
+    memcpy( header, GRID_MAGIC, GRID_MAGIC_SIZE );
+    header[ 4 ] = GRID_FILE_VERSION;
+    header[ 5 ] = 0;
+    header[ 6 ] = GRID_CELL_WIDTH;
+    header[ 7 ] = 0;
+    setLittleEndian32( &header[ 8 ], (uint32_t)dataArray->rowSize );
+    setLittleEndian32( &header[ 12 ], (uint32_t)dataArray->colSize );
+
+    saved = writeFully( fileDescriptor, header, GRID_HEADER_SIZE );
+
+    // little-endian hosts write the array storage as it is,
+    // others write one converted cell at a time
+    if( isLittleEndianHost() )
+       {
+        saved = saved && writeFully( fileDescriptor, dataArray->array,
+                                               cellCount * GRID_CELL_WIDTH );
+       }
+
+    else
+       {
+        for( index = 0; saved && index < cellCount; index++ )
+           {
+            setLittleEndian32( (unsigned char *)&cellBytes,
+                                         (uint32_t)dataArray->array[ index ] );
+
+            saved = writeFully( fileDescriptor, &cellBytes, GRID_CELL_WIDTH );
+           }
+       }
+
+    return close( fileDescriptor ) == 0 && saved;
+   }
+
+/*
+Name: uploadGrid
+Process: uploads a grid file in either format, chosen by its first bytes,
+         returns true if successful, false otherwise
+Function Input/Parameters: grid file name (const char *)
+Function Output/Parameters: data array (ArrayType *)
+Function Output/Returned: success of operation (bool)
+Device Input/HD: grid input from file
+Device Output/---: none
+Dependencies: isBinaryGridFile, loadBinaryGrid, uploadTextGrid
+*/
+bool uploadGrid( const char *fileName, ArrayType *dataArray )
+   {
+    if( isBinaryGridFile( fileName ) )
+       {
+        return loadBinaryGrid( fileName, dataArray );
+       }
+
+    return uploadTextGrid( fileName, dataArray );
+   }
+
+/*
+Name: uploadTextGrid
+Process: opens text grid file, gets array sizes after their leader text,
+         allocates array to those sizes, uploads the values in as few
+         calls as int counts allow, reading missing trailing values
+         as zero, closes file,
+         returns true if successful, false otherwise
+Function Input/Parameters: text grid file name (const char *)
+Function Output/Parameters: data array (ArrayType *)
+Function Output/Returned: success of operation (bool)
+Device Input/HD: text grid input from file
+Device Output/---: none
+Dependencies: openInputReader, readStringToDelimiterFromReader,
+              readIntegerFromReader, initializeArray,
+              readIntegersFromReader, closeInputReader
+*/
+bool uploadTextGrid( const char *fileName, ArrayType *dataArray )
+   {
+    size_t cellIndex = 0, cellCount;
+    int rowSize, colSize, chunkCount, readCount;
+    char tempStr[ MAX_STR_LEN ];
+    InputReaderType *reader = openInputReader( fileName );
+
+    if( reader == NULL )
+       {
+        return false;
+       }
+
+    // get leader line ahead of array height, then row height
+    readStringToDelimiterFromReader( reader, COLON, tempStr );
+
+    rowSize = readIntegerFromReader( reader );
+
+    // get leader line ahead of array width, then row width
+    readStringToDelimiterFromReader( reader, COLON, tempStr );
+
+    colSize = readIntegerFromReader( reader );
+
+    // size array from header, test for success
+    if( !initializeArray( dataArray, rowSize, colSize ) )
+       {
+        closeInputReader( reader );
+
+        return false;
+       }
+
+    // upload values in int sized chunks, parsed from the input buffer,
+    // stopping when the file runs short
+    cellCount = (size_t)rowSize * (size_t)colSize;
+
+    do
+       {
+        chunkCount = cellCount - cellIndex > (size_t)INT_MAX 
+                                    ? INT_MAX : (int)( cellCount - cellIndex );
+
+        readCount = readIntegersFromReader( reader, 
+                                 &dataArray->array[ cellIndex ], chunkCount );
+
+        cellIndex += (size_t)readCount;
+       }
+    while( readCount == chunkCount && cellIndex < cellCount );
+
+    // values missing from a short file read as zero
+    while( cellIndex < cellCount )
+       {
+        dataArray->array[ cellIndex ] = 0;
+
+        cellIndex++;
+       }
+
+    closeInputReader( reader );
+
+    return true;
+   }
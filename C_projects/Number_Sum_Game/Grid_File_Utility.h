@@ -0,0 +1,112 @@
+#ifndef GRID_FILE_UTILITY_H
+#define GRID_FILE_UTILITY_H
+
+// included headers
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "StandardConstants.h"
+#include "File_Input_Utility.h"
+#include "RB_Utility.h"
+
+// binary grid file layout, all fields little-endian:
+//    bytes  0-3   magic "NSGB"
+//    bytes  4-5   format version
+//    bytes  6-7   cell width in bytes
+//    bytes  8-11  row count
+//    bytes 12-15  column count
+// then row count * column count int32 cells, row-major like ArrayType
+typedef enum { GRID_FILE_VERSION = 1, GRID_HEADER_SIZE = 16,
+               GRID_CELL_WIDTH = 4, GRID_MAGIC_SIZE = 4 } GridFileData;
+
+// prototypes
+
+/*
+Name: convertTextGrid
+Process: uploads a text grid file and saves it as a binary grid file,
+         returns true if both steps succeed, false otherwise
+Function Input/Parameters: text grid file name (const char *),
+                           binary grid file name (const char *)
+Function Output/Parameters: none
+Function Output/Returned: success of operation (bool)
+Device Input/HD: text grid input from file
+Device Output/HD: binary grid written to file
+Dependencies: uploadTextGrid, saveBinaryGrid, clearArray
+*/
+bool convertTextGrid( const char *textFileName, const char *binaryFileName );
+
+/*
+Name: isBinaryGridFile
+Process: checks whether a file starts with the binary grid magic
+Function Input/Parameters: file name (const char *)
+Function Output/Parameters: none
+Function Output/Returned: result of test (bool)
+Device Input/HD: magic bytes read from file
+Device Output/---: none
+Dependencies: open, readFully, close, memcmp
+*/
+bool isBinaryGridFile( const char *fileName );
+
+/*
+Name: loadBinaryGrid
+Process: reads and checks the binary grid header, sizes the array,
+         then reads every cell with one read straight into the array
+         storage, byte swapping only on big-endian hosts,
+         returns true if the whole grid loaded, false otherwise
+Function Input/Parameters: binary grid file name (const char *)
+Function Output/Parameters: data array (ArrayType *)
+Function Output/Returned: success of operation (bool)
+Device Input/HD: binary grid input from file
+Device Output/---: none
+Dependencies: open, fstat, readFully, getLittleEndian32, initializeArray,
+              swapCellBytes, clearArray, close, memcmp
+*/
+bool loadBinaryGrid( const char *fileName, ArrayType *dataArray );
+
+/*
+Name: saveBinaryGrid
+Process: writes the binary grid header and every cell,
+         the cells in one write on little-endian hosts,
+         returns true if the whole grid was written, false otherwise
+Function Input/Parameters: binary grid file name (const char *),
+                           data array (const ArrayType *)
+Function Output/Parameters: none
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/HD: binary grid written to file
+Dependencies: open, setLittleEndian32, writeFully, swapCellBytes, close
+*/
+bool saveBinaryGrid( const char *fileName, const ArrayType *dataArray );
+
+/*
+Name: uploadGrid
+Process: uploads a grid file in either format, chosen by its first bytes,
+         returns true if successful, false otherwise
+Function Input/Parameters: grid file name (const char *)
+Function Output/Parameters: data array (ArrayType *)
+Function Output/Returned: success of operation (bool)
+Device Input/HD: grid input from file
+Device Output/---: none
+Dependencies: isBinaryGridFile, loadBinaryGrid, uploadTextGrid
+*/
+bool uploadGrid( const char *fileName, ArrayType *dataArray );
+
+/*
+Name: uploadTextGrid
+Process: opens text grid file, gets array sizes after their leader text,
+         allocates array to those sizes, uploads the values in as few
+         calls as int counts allow, reading missing trailing values
+         as zero, closes file,
+         returns true if successful, false otherwise
+Function Input/Parameters: text grid file name (const char *)
+Function Output/Parameters: data array (ArrayType *)
+Function Output/Returned: success of operation (bool)
+Device Input/HD: text grid input from file
+Device Output/---: none
+Dependencies: openInputReader, readStringToDelimiterFromReader,
+              readIntegerFromReader, initializeArray,
+              readIntegersFromReader, closeInputReader
+*/
+bool uploadTextGrid( const char *fileName, ArrayType *dataArray );
+
+#endif  // GRID_FILE_UTILITY_H
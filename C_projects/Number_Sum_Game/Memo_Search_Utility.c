@@ -0,0 +1,276 @@
+// included headers
+#include "Memo_Search_Utility.h"
+
+/*
+Name: getStateKey
+Process: returns the nonzero key of a cell and its entry direction
+Function Input/Parameters: column count of grid (int), cell (CellDataType),
+                           entry direction (EntryDirections)
+Function Output/Parameters: none
+Function Output/Returned: cell key (uint64_t)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+static uint64_t getStateKey( int colSize, CellDataType current,
+                                           EntryDirections entryDirection )
+   {
+    uint64_t cellIndex = (uint64_t)current.xLocation * colSize
+                                                       + current.yLocation;
+
+    return cellIndex * 4 + ( entryDirection - FROM_ABOVE ) + 1;
+   }
+
+/*
+Name: getStateSlot
+Process: returns first slot of a state's probe window, mixing key and
+         total with a multiply so nearby states spread over the table
+Function Input/Parameters: pointer to failed state table
+                                            (const FailedStateTableType *),
+                           cell key (uint64_t), total including cell (int)
+Function Output/Parameters: none
+Function Output/Returned: slot index (int)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+static int getStateSlot( const FailedStateTableType *failedStates,
+                                         uint64_t cellKey, int runningTotal )
+   {
+    uint64_t mixed = ( cellKey << 32 ) ^ (uint32_t)runningTotal;
+
+    mixed *= 0x9e3779b97f4a7c15ULL;
+
+    return (int)( ( mixed ^ ( mixed >> 29 ) ) & failedStates->slotMask );
+   }
+
+/*
+Name: clearFailedStateTable
+Process: releases heap memory held by failed state table, resets sizes
+         to zero, safe to call on a table that was never allocated
+Function Input/Parameters: pointer to failed state table
+                                                  (FailedStateTableType *)
+Function Output/Parameters: pointer to failed state table
+                                                  (FailedStateTableType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearFailedStateTable( FailedStateTableType *failedStates )
+   {
+    free( failedStates->slots );
+
+    failedStates->slots = NULL;
+    failedStates->slotMask = 0;
+   }
+
+/*
+Name: findSumMemoized
+Process: same search and first solution as findSumIterative, with
+         a failed state table so a cell entered in the same direction
+         with the same total is only searched past once; the table
+         is sized to the grid and built for this search alone, since
+         its states hold only for one grid and sum, and its lookup
+         and hit counts are kept in the search data,
+         runs without the table if it cannot be allocated
+Function Input/Parameters: pointer to search data (SearchContextType *)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/monitor: operation of backtracking
+Dependencies: initializeFailedStateTable, findSumIterative,
+              clearFailedStateTable
+*/
+bool findSumMemoized( SearchContextType *searchData )
+   {
+    FailedStateTableType failedStates;
+    bool found;
+
+    searchData->failedStates = NULL;
+
+    if( !initializeFailedStateTable( &failedStates,
+              searchData->dataArray->rowSize, searchData->dataArray->colSize ) )
+       {
+        return findSumIterative( searchData );
+       }
+
+    searchData->failedStates = &failedStates;
+
+    found = findSumIterative( searchData );
+
+    searchData->failedStates = NULL;
+    searchData->memoLookupCount = failedStates.lookupCount;
+    searchData->memoHitCount = failedStates.hitCount;
+
+    clearFailedStateTable( &failedStates );
+
+    return found;
+   }
+
+/*
+Name: getEntryDirection
+Process: returns direction a cell was entered from the cell before it
+         on the path, FROM_ABOVE unless both are in the same row
+Function Input/Parameters: previous and current cell (CellDataType)
+Function Output/Parameters: none
+Function Output/Returned: entry direction (EntryDirections)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+EntryDirections getEntryDirection( CellDataType previous,
+                                                    CellDataType current )
+   {
+    if( previous.xLocation != current.xLocation )
+       {
+        return FROM_ABOVE;
+       }
+
+    return previous.yLocation < current.yLocation
+                                                 ? MOVING_RIGHT : MOVING_LEFT;
+   }
+
+/*
+Name: initializeFailedStateTable
+Process: allocates an empty table with slots for a grid of the given
+         size, MEMO_SLOTS_PER_CELL per cell rounded up to a power of two
+         and kept within MIN_MEMO_SLOTS and MAX_MEMO_SLOTS, counts zeroed,
+         returns true if successful, false otherwise
+Function Input/Parameters: number of rows and columns (int)
+Function Output/Parameters: pointer to failed state table
+                                                  (FailedStateTableType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: calloc
+*/
+bool initializeFailedStateTable( FailedStateTableType *failedStates,
+                                                  int rowSize, int colSize )
+   {
+    long long wanted = (long long)rowSize * colSize * MEMO_SLOTS_PER_CELL;
+    int slotCount = MIN_MEMO_SLOTS;
+
+    while( slotCount < MAX_MEMO_SLOTS && slotCount < wanted )
+       {
+        slotCount *= 2;
+       }
+
+    failedStates->lookupCount = failedStates->hitCount = 0;
+    failedStates->storeCount = failedStates->evictionCount = 0;
+
+    failedStates->slots = calloc( slotCount, sizeof( FailedStateType ) );
+
+    if( failedStates->slots == NULL )
+       {
+        failedStates->slotMask = 0;
+
+        return false;
+       }
+
+    failedStates->slotMask = slotCount - 1;
+
+    return true;
+   }
+
+/*
+Name: isFailedState
+Process: counts a lookup, then searches the probe window of a state,
+         returns true and counts a hit if it is a known failed state,
+         false otherwise
+Function Input/Parameters: pointer to failed state table
+                                                  (FailedStateTableType *),
+                           column count of grid (int), cell (CellDataType),
+                           entry direction (EntryDirections),
+                           total including cell (int)
+Function Output/Parameters: pointer to failed state table with counts
+                                                  (FailedStateTableType *)
+Function Output/Returned: result of test (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: getStateKey, getStateSlot
+*/
+bool isFailedState( FailedStateTableType *failedStates, int colSize,
+                    CellDataType current, EntryDirections entryDirection,
+                    int runningTotal )
+   {
+    uint64_t cellKey = getStateKey( colSize, current, entryDirection );
+    int slotIndex = getStateSlot( failedStates, cellKey, runningTotal );
+    int probe;
+    FailedStateType *slot;
+
+    failedStates->lookupCount++;
+
+    for( probe = 0; probe < MEMO_PROBE_LIMIT; probe++ )
+       {
+        slot = &failedStates->slots[ ( slotIndex + probe )
+                                                  & failedStates->slotMask ];
+
+        // slots are never emptied, so no later slot holds the state
+        if( slot->cellKey == 0 )
+           {
+            return false;
+           }
+
+        if( slot->cellKey == cellKey && slot->runningTotal == runningTotal )
+           {
+            failedStates->hitCount++;
+
+            return true;
+           }
+       }
+
+    return false;
+   }
+
+/*
+Name: storeFailedState
+Process: places a failed state in the first empty slot of its probe
+         window, or over the first slot when the window is full,
+         counting the store and any eviction
+Function Input/Parameters: pointer to failed state table
+                                                  (FailedStateTableType *),
+                           column count of grid (int), cell (CellDataType),
+                           entry direction (EntryDirections),
+                           total including cell (int)
+Function Output/Parameters: pointer to failed state table with counts
+                                                  (FailedStateTableType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: getStateKey, getStateSlot
+*/
+void storeFailedState( FailedStateTableType *failedStates, int colSize,
+                       CellDataType current, EntryDirections entryDirection,
+                       int runningTotal )
+   {
+    uint64_t cellKey = getStateKey( colSize, current, entryDirection );
+    int slotIndex = getStateSlot( failedStates, cellKey, runningTotal );
+    int probe;
+    FailedStateType *slot = &failedStates->slots[ slotIndex ];
+
+    failedStates->storeCount++;
+
+    for( probe = 0; probe < MEMO_PROBE_LIMIT; probe++ )
+       {
+        slot = &failedStates->slots[ ( slotIndex + probe )
+                                                  & failedStates->slotMask ];
+
+        if( slot->cellKey == 0 )
+           {
+            break;
+           }
+       }
+
+    // full window, replace the first slot
+    if( probe == MEMO_PROBE_LIMIT )
+       {
+        slot = &failedStates->slots[ slotIndex ];
+
+        failedStates->evictionCount++;
+       }
+
+    slot->cellKey = cellKey;
+    slot->runningTotal = runningTotal;
+   }
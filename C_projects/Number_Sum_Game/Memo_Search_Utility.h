@@ -0,0 +1,144 @@
+#ifndef MEMO_SEARCH_UTILITY_H
+#define MEMO_SEARCH_UTILITY_H
+
+// included headers
+#include "RB_Utility.h"
+
+// local constants
+typedef enum { MIN_MEMO_SLOTS = 1 << 10, MAX_MEMO_SLOTS = 1 << 20,
+               MEMO_SLOTS_PER_CELL = 16, MEMO_PROBE_LIMIT = 4 } MemoData;
+
+// one known failed search state, a cell entered in one direction with
+// the path total including it; cellKey is 0 for an empty slot,
+// otherwise ( row-major cell index * 4 ) + entry direction index + 1
+typedef struct FailedStateStruct
+   {
+    uint64_t cellKey;
+
+    int runningTotal;
+   } FailedStateType;
+
+// bounded table of failed states for one search; the path can never
+// move up and can only keep its direction within a row, so a state
+// failing once fails from every prefix reaching it; slot count is a
+// power of two, a full probe window replaces its first slot
+typedef struct FailedStateTableStruct
+   {
+    FailedStateType *slots;
+
+    int slotMask;
+
+    long long lookupCount, hitCount, storeCount, evictionCount;
+   } FailedStateTableType;
+
+// prototypes
+
+/*
+Name: clearFailedStateTable
+Process: releases heap memory held by failed state table, resets sizes
+         to zero, safe to call on a table that was never allocated
+Function Input/Parameters: pointer to failed state table
+                                                  (FailedStateTableType *)
+Function Output/Parameters: pointer to failed state table
+                                                  (FailedStateTableType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearFailedStateTable( FailedStateTableType *failedStates );
+
+/*
+Name: findSumMemoized
+Process: same search and first solution as findSumIterative, with
+         a failed state table so a cell entered in the same direction
+         with the same total is only searched past once; the table
+         is sized to the grid and built for this search alone, since
+         its states hold only for one grid and sum, and its lookup
+         and hit counts are kept in the search data,
+         runs without the table if it cannot be allocated
+Function Input/Parameters: pointer to search data (SearchContextType *)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/monitor: operation of backtracking
+Dependencies: initializeFailedStateTable, findSumIterative,
+              clearFailedStateTable
+*/
+bool findSumMemoized( SearchContextType *searchData );
+
+/*
+Name: getEntryDirection
+Process: returns direction a cell was entered from the cell before it
+         on the path, FROM_ABOVE unless both are in the same row
+Function Input/Parameters: previous and current cell (CellDataType)
+Function Output/Parameters: none
+Function Output/Returned: entry direction (EntryDirections)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+EntryDirections getEntryDirection( CellDataType previous,
+                                                    CellDataType current );
+
+/*
+Name: initializeFailedStateTable
+Process: allocates an empty table with slots for a grid of the given
+         size, MEMO_SLOTS_PER_CELL per cell rounded up to a power of two
+         and kept within MIN_MEMO_SLOTS and MAX_MEMO_SLOTS, counts zeroed,
+         returns true if successful, false otherwise
+Function Input/Parameters: number of rows and columns (int)
+Function Output/Parameters: pointer to failed state table
+                                                  (FailedStateTableType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: calloc
+*/
+bool initializeFailedStateTable( FailedStateTableType *failedStates,
+                                                 int rowSize, int colSize );
+
+/*
+Name: isFailedState
+Process: counts a lookup, then searches the probe window of a state,
+         returns true and counts a hit if it is a known failed state,
+         false otherwise
+Function Input/Parameters: pointer to failed state table
+                                                  (FailedStateTableType *),
+                           column count of grid (int), cell (CellDataType),
+                           entry direction (EntryDirections),
+                           total including cell (int)
+Function Output/Parameters: pointer to failed state table with counts
+                                                  (FailedStateTableType *)
+Function Output/Returned: result of test (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: getStateKey, getStateSlot
+*/
+bool isFailedState( FailedStateTableType *failedStates, int colSize,
+                    CellDataType current, EntryDirections entryDirection,
+                    int runningTotal );
+
+/*
+Name: storeFailedState
+Process: places a failed state in the first empty slot of its probe
+         window, or over the first slot when the window is full,
+         counting the store and any eviction
+Function Input/Parameters: pointer to failed state table
+                                                  (FailedStateTableType *),
+                           column count of grid (int), cell (CellDataType),
+                           entry direction (EntryDirections),
+                           total including cell (int)
+Function Output/Parameters: pointer to failed state table with counts
+                                                  (FailedStateTableType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: getStateKey, getStateSlot
+*/
+void storeFailedState( FailedStateTableType *failedStates, int colSize,
+                       CellDataType current, EntryDirections entryDirection,
+                       int runningTotal );
+
+#endif  // MEMO_SEARCH_UTILITY_H
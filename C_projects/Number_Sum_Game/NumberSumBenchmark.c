@@ -0,0 +1,450 @@
+/*
+Number Sum Game solver benchmark
+
+Build with every game source file except PA04_MainDriver.c,
+which has the interactive main
+
+Usage: sumbench [rows] [cols] [selection] [low] [high] [seed] [targets]
+                [engine] [prune] [tiled]
+   selection: incremented, odd, even, or random
+   engine: recursive, iterative, parallel, reachability, memoized,
+           segment, bitboard, or compact
+   tiled: 1 stores the compact engine's 16 bit grid in 8 x 8 tiles,
+          0 stores it row-major
+   defaults: 8 8 random 100 999 1 20 iterative 1 0
+
+bitboard runs the small grid engine findSum picks for grids of at most
+64 cells, iterative always runs the generic engine, so comparing the two
+on the same grid gives the gain; larger grids run bitboard as iterative
+
+compact builds its 16 bit grid once before timing starts, like the prune
+table, so only search memory traffic is compared with iterative
+
+Half the targets are sums of seeded random paths, which always have
+a solution, the other half are one more, which often do not
+
+Output is one comma separated header line and one result line;
+the first column is the format version, which changes whenever
+the columns do, so results can be compared across releases;
+version 5 drops the padded column of versions 3 and 4
+*/
+
+// included headers
+#include <sys/resource.h>
+#include <time.h>
+#include "StandardConstants.h"
+#include "RB_Utility.h"
+#include "Compact_Search_Utility.h"
+
+// local constants
+typedef enum { BENCH_FORMAT_VERSION = 5, DEFAULT_BENCH_SIZE = 8,
+               DEFAULT_TARGET_COUNT = 20, MAX_TARGET_RUN = 2 } BenchmarkData;
+
+// prototypes
+bool generateGrid( ArrayType *dataArray, int rowSize, int colSize, 
+                   DataSelections selection, int lowValue, int highValue, 
+                   unsigned long long seed );
+int getPathTarget( const ArrayType *dataArray, unsigned long long *state );
+unsigned long long getRandomValue( unsigned long long *state );
+double getWallSeconds();
+const char *getEngineName( SearchModes searchMode );
+const char *getSelectionName( DataSelections selection );
+bool parseEngine( const char *name, SearchModes *searchMode );
+bool parseSelection( const char *name, DataSelections *selection );
+
+int main( int argc, char *argv[] )
+   {
+    // initialize program
+
+       // initialize variables
+       int rowSize = DEFAULT_BENCH_SIZE, colSize = DEFAULT_BENCH_SIZE;
+       int lowValue = THREE_DIGIT_LOW, highValue = THREE_DIGIT_HIGH;
+       int targetCount = DEFAULT_TARGET_COUNT, targetIndex, target;
+       int foundCount = 0, peakDepth = 0;
+       unsigned long long seed = 1, targetState;
+       long long nodeCount = 0, prunedCount = 0;
+       long long memoLookups = 0, memoHits = 0;
+       double startTime, wallTime;
+       bool usePrune = true, useTiled = false;
+       bool useCompact;
+       DataSelections selection = RANDOM;
+       SearchModes searchMode = ITERATIVE_SEARCH;
+       ArrayType dataArray = { NULL, 0, 0 };
+       PruneTableType pruneTable;
+       CompactGridType compactGrid;
+       SetType foundSet;
+       SearchContextType searchData;
+       struct rusage usage;
+
+    // get configuration, missing arguments keep defaults
+    if( ( argc > 1 && ( rowSize = atoi( argv[ 1 ] ) ) <= 0 )
+         || ( argc > 2 && ( colSize = atoi( argv[ 2 ] ) ) <= 0 )
+         || ( argc > 3 && !parseSelection( argv[ 3 ], &selection ) )
+         || ( argc > 6 && ( seed = strtoull( argv[ 6 ], NULL, 10 ) ) == 0 
+                                               && argv[ 6 ][ 0 ] != '0' )
+         || ( argc > 7 && ( targetCount = atoi( argv[ 7 ] ) ) <= 0 )
+         || ( argc > 8 && !parseEngine( argv[ 8 ], &searchMode ) ) )
+       {
+        fprintf( stderr, "Usage: %s [rows] [cols] [selection] [low] [high]"
+               " [seed] [targets] [engine] [prune] [tiled]\n", 
+                                                               argv[ 0 ] );
+
+        return 1;
+       }
+
+    lowValue = argc > 4 ? atoi( argv[ 4 ] ) : lowValue;
+    highValue = argc > 5 ? atoi( argv[ 5 ] ) : highValue;
+    usePrune = argc > 9 ? atoi( argv[ 9 ] ) != 0 : usePrune;
+    useTiled = argc > 10 ? atoi( argv[ 10 ] ) != 0 : useTiled;
+
+    if( lowValue > highValue
+          || !generateGrid( &dataArray, rowSize, colSize, selection,
+                                               lowValue, highValue, seed ) )
+       {
+        fprintf( stderr, "Grid Generation Failed - Benchmark Aborted\n" );
+
+        return 1;
+       }
+
+    usePrune = usePrune && initializePruneTable( &pruneTable, &dataArray );
+
+    useCompact = searchMode == COMPACT_SEARCH
+             && initializeCompactGrid( &compactGrid, &dataArray, useTiled );
+
+    initializeGridSet( &foundSet, rowSize, colSize );
+
+    // run searches, timing only the searches
+    targetState = seed ^ 0x5bd1e995ULL;
+
+    startTime = getWallSeconds();
+
+    for( targetIndex = 0; targetIndex < targetCount; targetIndex++ )
+       {
+        target = getPathTarget( &dataArray, &targetState ) + targetIndex % 2;
+
+        initializeSearchContext( &searchData, &dataArray, 
+                  usePrune ? &pruneTable : NULL, &foundSet, target, false );
+
+        searchData.compactGrid = useCompact ? &compactGrid : NULL;
+
+        if( runSearch( &searchData, searchMode ) )
+           {
+            foundCount++;
+           }
+
+        nodeCount += searchData.iterationCount;
+        prunedCount += searchData.prunedCount;
+        memoLookups += searchData.memoLookupCount;
+        memoHits += searchData.memoHitCount;
+
+        if( searchData.peakDepth > peakDepth )
+           {
+            peakDepth = searchData.peakDepth;
+           }
+
+        emptySet( &foundSet );
+       }
+
+    wallTime = getWallSeconds() - startTime;
+
+    getrusage( RUSAGE_SELF, &usage );
+
+    // report results
+    printf( "format,rows,cols,selection,low,high,seed,engine,prune,targets,"
+            "found,nodes,pruned,wall_sec,nodes_per_sec,peak_depth,"
+            "grid_bytes,peak_rss_kb,memo_lookups,memo_hits,tiled\n" );
+
+    printf( "%d,%d,%d,%s,%d,%d,%llu,%s,%d,%d,%d,%lld,%lld,%.6f,%.0f,%d,"
+            "%zu,%ld,%lld,%lld,%d\n", BENCH_FORMAT_VERSION, rowSize, colSize, 
+            getSelectionName( selection ), lowValue, highValue, seed,
+            getEngineName( searchMode ), usePrune ? 1 : 0, targetCount,
+            foundCount, nodeCount, prunedCount, wallTime,
+            wallTime > 0.0 ? nodeCount / wallTime : 0.0, peakDepth,
+            (size_t)rowSize * colSize * sizeof( int ), usage.ru_maxrss,
+            memoLookups, memoHits, useCompact && useTiled ? 1 : 0 );
+
+    // end program
+    clearSet( &foundSet );
+
+    if( usePrune )
+       {
+        clearPruneTable( &pruneTable );
+       }
+
+    if( useCompact )
+       {
+        clearCompactGrid( &compactGrid );
+       }
+
+    clearArray( &dataArray );
+
+    return 0;
+   }
+
+/*
+Name: generateGrid
+Process: allocates array and fills it from seed, as values stepping up
+         from low and wrapping past high, or random odd, random even,
+         or any random values from low to high, 
+         returns true if successful, false otherwise
+Function Input/Parameters: number of rows and columns (int),
+                           data selection (DataSelections),
+                           lowest and highest value (int),
+                           seed (unsigned long long)
+Function Output/Parameters: pointer to data array (ArrayType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: initializeArray, getRandomValue
+*/
+bool generateGrid( ArrayType *dataArray, int rowSize, int colSize, 
+                   DataSelections selection, int lowValue, int highValue, 
+                   unsigned long long seed )
+   {
+    size_t index, cellCount = (size_t)rowSize * colSize;
+    long long span = (long long)highValue - lowValue + 1, value;
+    unsigned long long state = seed;
+
+    if( !initializeArray( dataArray, rowSize, colSize ) )
+       {
+        return false;
+       }
+
+    for( index = 0; index < cellCount; index++ )
+       {
+        if( selection == INCREMENTED )
+           {
+            value = lowValue + (long long)( index % span );
+           }
+
+        else
+           {
+            value = lowValue + (long long)( getRandomValue( &state ) % span );
+
+            // move to nearest value of the wanted parity inside the range
+            if( ( selection == ODD && value % 2 == 0 )
+                  || ( selection == EVEN && value % 2 != 0 ) )
+               {
+                value = value + 1 <= highValue ? value + 1 
+                      : value - 1 >= lowValue ? value - 1 : value;
+               }
+           }
+
+        dataArray->array[ index ] = (int)value;
+       }
+
+    return true;
+   }
+
+/*
+Name: getEngineName
+Process: returns report name of search engine
+Function Input/Parameters: search engine (SearchModes)
+Function Output/Parameters: none
+Function Output/Returned: engine name (const char *)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+const char *getEngineName( SearchModes searchMode )
+   {
+    switch( searchMode )
+       {
+        case RECURSIVE_SEARCH:
+           return "recursive";
+
+        case PARALLEL_SEARCH:
+           return "parallel";
+
+        case REACHABILITY_SEARCH:
+           return "reachability";
+
+        case MEMOIZED_SEARCH:
+           return "memoized";
+
+        case SEGMENT_SEARCH:
+           return "segment";
+
+        case BITBOARD_SEARCH:
+           return "bitboard";
+
+        case COMPACT_SEARCH:
+           return "compact";
+
+        default:
+           return "iterative";
+       }
+   }
+
+/*
+Name: getPathTarget
+Process: walks a random path from a random top row cell, moving up to
+         MAX_TARGET_RUN cells left or right in each row before stepping
+         down, so targets stay near typical path totals,
+         and returns its total, which is always a reachable sum for 
+         grids of positive values
+Function Input/Parameters: pointer to data array (const ArrayType *),
+                           generator state (unsigned long long *)
+Function Output/Parameters: generator state (unsigned long long *)
+Function Output/Returned: path total (int)
+Device Input/---: none
+Device Output/---: none
+Dependencies: getRandomValue, getArrayValue
+*/
+int getPathTarget( const ArrayType *dataArray, unsigned long long *state )
+   {
+    int rowIndex, colIndex, endColumn, step, total = 0;
+
+    colIndex = (int)( getRandomValue( state ) % dataArray->colSize );
+
+    for( rowIndex = 0; rowIndex < dataArray->rowSize; rowIndex++ )
+       {
+        endColumn = colIndex + (int)( getRandomValue( state ) 
+                               % ( 2 * MAX_TARGET_RUN + 1 ) ) - MAX_TARGET_RUN;
+
+        endColumn = endColumn < 0 ? 0 
+              : endColumn >= dataArray->colSize 
+                                     ? dataArray->colSize - 1 : endColumn;
+
+        step = endColumn < colIndex ? -1 : 1;
+
+        total += getArrayValue( dataArray, rowIndex, colIndex );
+
+        while( colIndex != endColumn )
+           {
+            colIndex += step;
+
+            total += getArrayValue( dataArray, rowIndex, colIndex );
+           }
+       }
+
+    return total;
+   }
+
+/*
+Name: getRandomValue
+Process: advances generator state and returns next value (splitmix64),
+         the same seed always gives the same sequence on every platform
+Function Input/Parameters: generator state (unsigned long long *)
+Function Output/Parameters: generator state (unsigned long long *)
+Function Output/Returned: next value (unsigned long long)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+unsigned long long getRandomValue( unsigned long long *state )
+   {
+    unsigned long long value;
+
+    *state += 0x9e3779b97f4a7c15ULL;
+
+    value = *state;
+    value = ( value ^ ( value >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+    value = ( value ^ ( value >> 27 ) ) * 0x94d049bb133111ebULL;
+
+    return value ^ ( value >> 31 );
+   }
+
+/*
+Name: getSelectionName
+Process: returns report name of data selection
+Function Input/Parameters: data selection (DataSelections)
+Function Output/Parameters: none
+Function Output/Returned: selection name (const char *)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+const char *getSelectionName( DataSelections selection )
+   {
+    switch( selection )
+       {
+        case INCREMENTED:
+           return "incremented";
+
+        case ODD:
+           return "odd";
+
+        case EVEN:
+           return "even";
+
+        default:
+           return "random";
+       }
+   }
+
+/*
+Name: getWallSeconds
+Process: returns monotonic wall clock time in seconds
+Function Input/Parameters: none
+Function Output/Parameters: none
+Function Output/Returned: time in seconds (double)
+Device Input/---: none
+Device Output/---: none
+Dependencies: clock_gettime
+*/
+double getWallSeconds()
+   {
+    struct timespec now;
+
+    clock_gettime( CLOCK_MONOTONIC, &now );
+
+    return now.tv_sec + now.tv_nsec / 1e9;
+   }
+
+/*
+Name: parseEngine
+Process: sets search engine from its report name,
+         returns true if name is known, false otherwise
+Function Input/Parameters: engine name (const char *)
+Function Output/Parameters: search engine (SearchModes *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: getEngineName, strcmp
+*/
+bool parseEngine( const char *name, SearchModes *searchMode )
+   {
+    SearchModes candidate;
+
+    for( candidate = RECURSIVE_SEARCH; candidate <= COMPACT_SEARCH;
+                                                              candidate++ )
+       {
+        if( strcmp( name, getEngineName( candidate ) ) == 0 )
+           {
+            *searchMode = candidate;
+
+            return true;
+           }
+       }
+
+    return false;
+   }
+
+/*
+Name: parseSelection
+Process: sets data selection from its report name,
+         returns true if name is known, false otherwise
+Function Input/Parameters: selection name (const char *)
+Function Output/Parameters: data selection (DataSelections *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: getSelectionName, strcmp
+*/
+bool parseSelection( const char *name, DataSelections *selection )
+   {
+    DataSelections candidate;
+
+    for( candidate = INCREMENTED; candidate <= RANDOM; candidate++ )
+       {
+        if( strcmp( name, getSelectionName( candidate ) ) == 0 )
+           {
+            *selection = candidate;
+
+            return true;
+           }
+       }
+
+    return false;
+   }
@@ -3,20 +3,39 @@
 #include "File_Input_Utility.h"
 #include "Console_IO_Utility.h"
 #include "RB_Utility.h"
+#include "Batch_Query_Utility.h"
+#include "Grid_File_Utility.h"
 
 // prototypes
-bool uploadData( const char *fileName, ArrayType *dataArray );
+bool runBatch( const char *gridFileName, const char *targetFileName,
+                                                   SearchModes searchMode );
 
-int main()
+int main( int argc, char *argv[] )
    {
     // initialize program
 
        // initialize variables
        int testValue = 896;
-       ArrayType dataArray;
+       ArrayType dataArray = { NULL, 0, 0 };
+       PruneTableType pruneTable;
        bool verboseFlag = true;
+       SearchModes searchMode = ITERATIVE_SEARCH;
        char fileName[ STD_STR_LEN ];
 
+    // -convert rewrites a text grid file as a binary grid file
+    if( argc > 3 && strcmp( argv[ 1 ], "-convert" ) == 0 )
+       {
+        return convertTextGrid( argv[ 2 ], argv[ 3 ] ) ? 0 : 1;
+       }
+
+    // grid file on the command line runs a batch of targets,
+    // from the target file if given, otherwise from standard input
+    if( argc > 1 )
+       {
+        return runBatch( argv[ 1 ], argc > 2 ? argv[ 2 ] : NULL, 
+                                                 searchMode ) ? 0 : 1;
+       }
+
        // title
        printf( "\nNumber Path Game\n" );
        printf(   "================\n\n");
@@ -28,11 +47,25 @@ int main()
     testValue = promptForInteger( "Enter desired sum value : " );
    
     // get data
-    if( uploadData( fileName, &dataArray ) )
+    if( uploadGrid( fileName, &dataArray ) )
        {
-        dumpArray( "Input Verification Array Dump:", dataArray );
+        dumpArray( "Input Verification Array Dump:", &dataArray );
 
-        findSum( dataArray, testValue, verboseFlag );
+        // prune with reachable sum bounds when the table can be built
+        if( initializePruneTable( &pruneTable, &dataArray ) )
+           {
+            findSum( &dataArray, &pruneTable, 
+                                     testValue, searchMode, verboseFlag );
+
+            clearPruneTable( &pruneTable );
+           }
+
+        else
+           {
+            findSum( &dataArray, NULL, testValue, searchMode, verboseFlag );
+           }
+
+        clearArray( &dataArray );
        }
 
     else
@@ -48,48 +81,68 @@ int main()
    }
     
 /*
-Name: uploadData
-Process: opens file, gets array sizes, uploads array, closes file
-Function Input/Parameters: file name (const char *)
-Function Output/Parameters: data array (ArrayType)
+Name: runBatch
+Process: loads grid and its prune table once, then answers every target
+         in the target file, or standard input if no file name is given,
+         writing machine readable results to standard output
+Function Input/Parameters: grid file name (const char *),
+                           target file name or NULL (const char *),
+                           search engine (SearchModes)
+Function Output/Parameters: none
 Function Output/Returned: operation success (bool)
-Device Input/HD: data input from file
-Device Output/---: none
-Dependencies: File_Input_Utility tools
+Device Input/HD: grid and targets input from files
+Device Output/monitor: batch results, or failure message
+Dependencies: uploadGrid, initializePruneTable, fopen, runBatchQueries,
+              fclose, clearPruneTable, clearArray, fprintf
 */
-bool uploadData( const char *fileName, ArrayType *dataArray )
+bool runBatch( const char *gridFileName, const char *targetFileName,
+                                                   SearchModes searchMode )
    {
-    int rowIndex, colIndex;
-    char tempStr[ STD_STR_LEN ];
-     
-    // Open file, test for success
-    if( openInputFile( fileName ) )
+    ArrayType dataArray = { NULL, 0, 0 };
+    PruneTableType pruneTable;
+    const PruneTableType *prunePtr = NULL;
+    FILE *targetFile = stdin;
+
+    if( !uploadGrid( gridFileName, &dataArray ) )
+       {
+        fprintf( stderr, "Data File Access Failed - Batch Aborted\n" );
+
+        return false;
+       }
+
+    if( targetFileName != NULL )
        {
-        // get leader line ahead of array height
-        readStringToDelimiterFromFile( COLON, tempStr );
-        
-        // get row height
-        dataArray->rowSize = readIntegerFromFile();
-         
-        // get leader line ahead of array width
-        readStringToDelimiterFromFile( COLON, tempStr );
-        
-        // get row width
-        dataArray->colSize = readIntegerFromFile();
-         
-        for( rowIndex = 0; rowIndex < dataArray->rowSize; rowIndex++ )
-           {                
-            for( colIndex = 0; colIndex < dataArray->colSize; colIndex++ )
-               {
-                dataArray->array[ rowIndex ][ colIndex ] 
-                                           = readIntegerFromFile();
-               }
+        targetFile = fopen( targetFileName, "r" );
+
+        if( targetFile == NULL )
+           {
+            fprintf( stderr, "Target File Access Failed - Batch Aborted\n" );
+
+            clearArray( &dataArray );
+
+            return false;
            }
+       }
+
+    // prune with reachable sum bounds when the table can be built
+    if( initializePruneTable( &pruneTable, &dataArray ) )
+       {
+        prunePtr = &pruneTable;
+       }
 
-        closeInputFile();
+    runBatchQueries( &dataArray, prunePtr, searchMode, targetFile, stdout );
 
-        return true;
+    if( targetFile != stdin )
+       {
+        fclose( targetFile );
        }
-   
-    return false;
+
+    if( prunePtr != NULL )
+       {
+        clearPruneTable( &pruneTable );
+       }
+
+    clearArray( &dataArray );
+
+    return true;
    }
@@ -0,0 +1,522 @@
+// included headers
+#include "Parallel_Search_Utility.h"
+
+/*
+Name: addSearchTask
+Process: appends task holding a copy of the current path to the task list,
+         growing the list and cell pool as needed, returns true 
+         if successful, false otherwise with the allocation failure noted
+Function Input/Parameters: pointer to task list (TaskListType *),
+                           current path (const SetType *),
+                           total of path (int), solved flag (bool)
+Function Output/Parameters: pointer to task list (TaskListType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: realloc, memcpy
+*/
+bool addSearchTask( TaskListType *taskList, const SetType *pathSet,
+                                           int runningTotal, bool solved )
+   {
+    int newCapacity;
+    SearchTaskType *newTasks, *task;
+    CellDataType *newCells;
+
+    if( taskList->size == taskList->capacity )
+       {
+        newCapacity = taskList->capacity > 0 
+                                 ? 2 * taskList->capacity : TASK_LIST_START;
+
+        newTasks = realloc( taskList->tasks, 
+                                 newCapacity * sizeof( SearchTaskType ) );
+
+        if( newTasks == NULL )
+           {
+            taskList->allocFailed = true;
+
+            return false;
+           }
+
+        taskList->tasks = newTasks;
+
+        taskList->capacity = newCapacity;
+       }
+
+    if( taskList->cellCount + pathSet->size > taskList->cellCapacity )
+       {
+        newCapacity = taskList->cellCapacity > 0 
+                    ? 2 * taskList->cellCapacity : TASK_LIST_START;
+
+        while( newCapacity < taskList->cellCount + pathSet->size )
+           {
+            newCapacity *= 2;
+           }
+
+        newCells = realloc( taskList->cells, 
+                                   newCapacity * sizeof( CellDataType ) );
+
+        if( newCells == NULL )
+           {
+            taskList->allocFailed = true;
+
+            return false;
+           }
+
+        taskList->cells = newCells;
+
+        taskList->cellCapacity = newCapacity;
+       }
+
+    task = &taskList->tasks[ taskList->size ];
+
+    task->pathStart = taskList->cellCount;
+    task->pathLength = pathSet->size;
+    task->runningTotal = runningTotal;
+    task->solved = solved;
+
+    memcpy( &taskList->cells[ taskList->cellCount ], pathSet->setArray,
+                                    pathSet->size * sizeof( CellDataType ) );
+
+    taskList->cellCount += pathSet->size;
+
+    taskList->size++;
+
+    return true;
+   }
+
+/*
+Name: buildTaskList
+Process: runs the serial search down to the split depth, recording each
+         path that reaches it as a task in serial order; a solution
+         found ahead of the split depth is recorded as a solved task and
+         ends the list since no later task can come first,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           split depth (int)
+Function Output/Parameters: pointer to search data with counts and peak
+                            depth updated (SearchContextType *),
+                            pointer to task list (TaskListType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: initializeSearchStack, checkLocation, continueSearch,
+              emptySet, clearSearchStack
+*/
+bool buildTaskList( SearchContextType *searchData, int splitDepth,
+                                                  TaskListType *taskList )
+   {
+    int runningTotal = 0;
+    SearchContextType splitData = *searchData;
+    SearchStackType searchStack;
+    SetType *foundSet = searchData->foundSet;
+    CellDataType current;
+    ControlCodes locationResult;
+
+    taskList->size = taskList->cellCount = 0;
+    taskList->allocFailed = false;
+
+    if( !initializeSearchStack( &searchStack ) )
+       {
+        return false;
+       }
+
+    splitData.iterationCount = splitData.prunedCount = 0;
+    splitData.peakDepth = 0;
+    splitData.verbose = false;
+    splitData.visitPath = collectSearchTask;
+    splitData.visitContext = taskList;
+    splitData.splitDepth = splitDepth;
+    splitData.stopIndex = NULL;
+    splitData.restartTopRow = true;
+
+    locationResult = checkLocation( &splitData, &runningTotal, 0, 0,
+                                                           1, &current );
+
+    continueSearch( &splitData, &searchStack, 0, 
+                                   locationResult, current, runningTotal );
+
+    // a stopped list leaves its path in the set
+    emptySet( foundSet );
+
+    clearSearchStack( &searchStack );
+
+    searchData->iterationCount += splitData.iterationCount;
+    searchData->prunedCount += splitData.prunedCount;
+
+    if( splitData.peakDepth > searchData->peakDepth )
+       {
+        searchData->peakDepth = splitData.peakDepth;
+       }
+
+    return !taskList->allocFailed;
+   }
+
+/*
+Name: clearTaskList
+Process: releases heap memory held by task list, resets sizes to zero
+Function Input/Parameters: pointer to task list (TaskListType *)
+Function Output/Parameters: pointer to task list (TaskListType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearTaskList( TaskListType *taskList )
+   {
+    free( taskList->tasks );
+    free( taskList->cells );
+
+    taskList->tasks = NULL;
+    taskList->cells = NULL;
+
+    taskList->size = taskList->capacity = 0;
+    taskList->cellCount = taskList->cellCapacity = 0;
+   }
+
+/*
+Name: collectSearchTask
+Process: path visitor for buildTaskList, records path as a task,
+         returns true to keep splitting, false after a solved task
+         or a failed allocation
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           total of path (int),
+                           path result (ControlCodes)
+Function Output/Parameters: pointer to search data with task list
+                            in visit context (SearchContextType *)
+Function Output/Returned: continue flag (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: addSearchTask
+*/
+bool collectSearchTask( SearchContextType *searchData, int runningTotal,
+                                                   ControlCodes pathResult )
+   {
+    bool solved = pathResult == SOLUTION_FOUND;
+
+    if( !addSearchTask( searchData->visitContext, searchData->foundSet,
+                                                    runningTotal, solved ) )
+       {
+        return false;
+       }
+
+    return !solved;
+   }
+
+/*
+Name: findSumParallel
+Process: splits the search into subtrees in serial search order, 
+         deepening the split until there are enough tasks to share,
+         then runs the tasks on worker threads that take the next task
+         as they finish one; a worker finding a solution cancels every
+         task after its own, and the lowest solved task wins, so the
+         solution is the one the serial search finds first,
+         search data counts are totals over all threads plus the
+         final split, and the peak depth is the deepest any thread
+         or the final split reached,
+         the calling thread works alongside the others and runs the
+         search alone when threads cannot be started,
+         falls back to findSumIterative if work cannot be allocated
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           number of threads to use (int)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: buildTaskList, clearTaskList, malloc, free, 
+              pthread_create, pthread_join, pthread_mutex_init,
+              pthread_mutex_destroy, runSearchWorker, addItem,
+              findSumIterative, atomic_init, atomic_load
+*/
+bool findSumParallel( SearchContextType *searchData, int threadCount )
+   {
+    int splitDepth, taskTarget, threadIndex, index, startedCount = 0;
+    int startIterations = searchData->iterationCount;
+    int startPruned = searchData->prunedCount;
+    int startPeak = searchData->peakDepth;
+    TaskListType taskList = { NULL, 0, 0, NULL, 0, 0, false };
+    ParallelSearchType workData;
+    pthread_t threads[ MAX_SEARCH_THREADS ];
+    bool found = false, listBuilt = true;
+
+    threadCount = threadCount < 1 ? 1 
+                 : threadCount > MAX_SEARCH_THREADS 
+                                        ? MAX_SEARCH_THREADS : threadCount;
+
+    taskTarget = threadCount * TASKS_PER_THREAD;
+
+    // deepen the split until there is enough work to share
+    for( splitDepth = 1; listBuilt && splitDepth <= MAX_SPLIT_DEPTH; 
+                                                              splitDepth++ )
+       {
+        // only the final split's prefix nodes count, earlier ones repeat
+        searchData->iterationCount = startIterations;
+        searchData->prunedCount = startPruned;
+        searchData->peakDepth = startPeak;
+
+        listBuilt = buildTaskList( searchData, splitDepth, &taskList );
+
+        if( taskList.size == 0 || taskList.size >= taskTarget 
+                         || taskList.tasks[ taskList.size - 1 ].solved )
+           {
+            break;
+           }
+       }
+
+    workData.bestPath = malloc( (size_t)searchData->dataArray->rowSize
+              * searchData->dataArray->colSize * sizeof( CellDataType ) );
+
+    if( !listBuilt || workData.bestPath == NULL 
+             || pthread_mutex_init( &workData.resultLock, NULL ) != 0 )
+       {
+        free( workData.bestPath );
+
+        clearTaskList( &taskList );
+
+        // the serial search counts its own prefix nodes
+        searchData->iterationCount = startIterations;
+        searchData->prunedCount = startPruned;
+        searchData->peakDepth = startPeak;
+
+        return findSumIterative( searchData );
+       }
+
+    workData.searchData = searchData;
+    workData.taskList = &taskList;
+    workData.bestLength = 0;
+    workData.iterationCount = workData.prunedCount = 0;
+    workData.peakDepth = 0;
+
+    atomic_init( &workData.nextTask, 0 );
+    atomic_init( &workData.bestTask, INT_MAX );
+
+    for( threadIndex = 1; threadIndex < threadCount; threadIndex++ )
+       {
+        if( pthread_create( &threads[ startedCount ], NULL, 
+                                       runSearchWorker, &workData ) == 0 )
+           {
+            startedCount++;
+           }
+       }
+
+    runSearchWorker( &workData );
+
+    for( threadIndex = 0; threadIndex < startedCount; threadIndex++ )
+       {
+        pthread_join( threads[ threadIndex ], NULL );
+       }
+
+    pthread_mutex_destroy( &workData.resultLock );
+
+    searchData->iterationCount += workData.iterationCount;
+    searchData->prunedCount += workData.prunedCount;
+
+    if( workData.peakDepth > searchData->peakDepth )
+       {
+        searchData->peakDepth = workData.peakDepth;
+       }
+
+    if( atomic_load( &workData.bestTask ) < INT_MAX )
+       {
+        for( index = 0; index < workData.bestLength; index++ )
+           {
+            addItem( searchData->foundSet, workData.bestPath[ index ] );
+           }
+
+        found = true;
+       }
+
+    // every worker failed to set up, tasks were never run
+    else if( atomic_load( &workData.nextTask ) < taskList.size )
+       {
+        searchData->iterationCount = startIterations;
+        searchData->prunedCount = startPruned;
+        searchData->peakDepth = startPeak;
+
+        found = findSumIterative( searchData );
+       }
+
+    free( workData.bestPath );
+
+    clearTaskList( &taskList );
+
+    return found;
+   }
+
+/*
+Name: getSearchThreadCount
+Process: returns number of online processors, 
+         limited to 1 through MAX_SEARCH_THREADS
+Function Input/Parameters: none
+Function Output/Parameters: none
+Function Output/Returned: thread count (int)
+Device Input/---: none
+Device Output/---: none
+Dependencies: sysconf
+*/
+int getSearchThreadCount()
+   {
+    long processorCount = sysconf( _SC_NPROCESSORS_ONLN );
+
+    if( processorCount < 1 )
+       {
+        return 1;
+       }
+
+    if( processorCount > MAX_SEARCH_THREADS )
+       {
+        return MAX_SEARCH_THREADS;
+       }
+
+    return (int)processorCount;
+   }
+
+/*
+Name: runSearchTask
+Process: rebuilds a task's path in the worker's set and stack, 
+         then searches the subtree below it without restarting,
+         leaves the set holding the solution path when one is found,
+         returns true if a solution is found, false otherwise
+Function Input/Parameters: pointer to worker search data 
+                                                   (SearchContextType *),
+                           pointer to worker frame stack (SearchStackType *),
+                           pointer to task list (const TaskListType *),
+                           task index (int)
+Function Output/Parameters: pointer to worker search data 
+                                                   (SearchContextType *),
+                            pointer to worker frame stack (SearchStackType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: addItem, pushSearchFrame, continueSearch
+*/
+bool runSearchTask( SearchContextType *workerData, 
+                    SearchStackType *searchStack, 
+                    const TaskListType *taskList, int taskIndex )
+   {
+    int index, runningTotal = 0;
+    const SearchTaskType *task = &taskList->tasks[ taskIndex ];
+    const CellDataType *path = &taskList->cells[ task->pathStart ];
+
+    for( index = 0; index < task->pathLength; index++ )
+       {
+        runningTotal += path[ index ].dataValue;
+
+        addItem( workerData->foundSet, path[ index ] );
+
+        // frames below the task's own are never advanced
+        if( !task->solved 
+             && !pushSearchFrame( searchStack, path[ index ], 
+                                                   runningTotal, 0 ) )
+           {
+            return false;
+           }
+       }
+
+    if( task->solved )
+       {
+        return true;
+       }
+
+    workerData->taskIndex = taskIndex;
+
+    return continueSearch( workerData, searchStack, task->pathLength - 1,
+               INVALID_ITEM, path[ task->pathLength - 1 ], runningTotal );
+   }
+
+/*
+Name: runSearchWorker
+Process: thread body, takes tasks in order until none remain or every 
+         remaining task comes after a solved one, keeps the solution 
+         of the lowest solved task and adds its counts to the totals,
+         keeping the deepest level reached
+Function Input/Parameters: pointer to shared work data 
+                                          (ParallelSearchType * as void *)
+Function Output/Parameters: pointer to shared work data 
+                                          (ParallelSearchType * as void *)
+Function Output/Returned: NULL (void *)
+Device Input/---: none
+Device Output/---: none
+Dependencies: initializeGridSet, initializeSearchStack, runSearchTask,
+              emptySet, memcpy, clearSet, clearSearchStack,
+              pthread_mutex_lock, pthread_mutex_unlock, atomic_fetch_add,
+              atomic_load, atomic_store
+*/
+void *runSearchWorker( void *workPtr )
+   {
+    int taskIndex;
+    ParallelSearchType *workData = workPtr;
+    const TaskListType *taskList = workData->taskList;
+    SearchContextType workerData = *workData->searchData;
+    SearchStackType searchStack;
+    SetType workerSet;
+    bool found;
+
+    if( !initializeGridSet( &workerSet, workerData.dataArray->rowSize,
+                                           workerData.dataArray->colSize ) 
+          || !initializeSearchStack( &searchStack ) )
+       {
+        clearSet( &workerSet );
+
+        return NULL;
+       }
+
+    workerData.foundSet = &workerSet;
+    workerData.iterationCount = workerData.prunedCount = 0;
+    workerData.peakDepth = 0;
+    workerData.verbose = false;
+    workerData.visitPath = NULL;
+    workerData.stopIndex = &workData->bestTask;
+    workerData.restartTopRow = false;
+
+    taskIndex = atomic_fetch_add( &workData->nextTask, 1 );
+
+    while( taskIndex < taskList->size 
+                        && taskIndex < atomic_load( &workData->bestTask ) )
+       {
+        found = runSearchTask( &workerData, &searchStack, 
+                                                     taskList, taskIndex );
+
+        if( found )
+           {
+            pthread_mutex_lock( &workData->resultLock );
+
+            if( taskIndex < atomic_load( &workData->bestTask ) )
+               {
+                memcpy( workData->bestPath, workerSet.setArray,
+                                 workerSet.size * sizeof( CellDataType ) );
+
+                workData->bestLength = workerSet.size;
+
+                atomic_store( &workData->bestTask, taskIndex );
+               }
+
+            pthread_mutex_unlock( &workData->resultLock );
+           }
+
+        // reset set and stack for the next task
+        emptySet( &workerSet );
+
+        searchStack.size = 0;
+
+        taskIndex = atomic_fetch_add( &workData->nextTask, 1 );
+       }
+
+    pthread_mutex_lock( &workData->resultLock );
+
+    workData->iterationCount += workerData.iterationCount;
+    workData->prunedCount += workerData.prunedCount;
+
+    if( workerData.peakDepth > workData->peakDepth )
+       {
+        workData->peakDepth = workerData.peakDepth;
+       }
+
+    pthread_mutex_unlock( &workData->resultLock );
+
+    clearSearchStack( &searchStack );
+
+    clearSet( &workerSet );
+
+    return NULL;
+   }
@@ -0,0 +1,212 @@
+#ifndef PARALLEL_SEARCH_UTILITY_H
+#define PARALLEL_SEARCH_UTILITY_H
+
+// included headers
+#include <pthread.h>
+#include <unistd.h>
+#include "RB_Utility.h"
+
+// local constants
+typedef enum { MAX_SEARCH_THREADS = 64, TASKS_PER_THREAD = 8, 
+               MAX_SPLIT_DEPTH = 24, TASK_LIST_START = 64 } ParallelData;
+
+// one independent piece of the search: the path that leads to a subtree
+// at split depth, or a complete solution found ahead of the split depth,
+// path cells are held in the task list cell pool
+typedef struct SearchTaskStruct
+   {
+    int pathStart, pathLength;
+
+    int runningTotal;
+
+    bool solved;
+   } SearchTaskType;
+
+// tasks in the order the serial search would reach them
+typedef struct TaskListStruct
+   {
+    SearchTaskType *tasks;
+
+    int size, capacity;
+
+    CellDataType *cells;
+
+    int cellCount, cellCapacity;
+
+    bool allocFailed;
+   } TaskListType;
+
+// state shared by the search workers, best task is the lowest task
+// index known to hold a solution (INT_MAX while none is known)
+typedef struct ParallelSearchStruct
+   {
+    const SearchContextType *searchData;
+
+    const TaskListType *taskList;
+
+    atomic_int nextTask, bestTask;
+
+    pthread_mutex_t resultLock;
+
+    CellDataType *bestPath;
+
+    int bestLength;
+
+    int iterationCount, prunedCount, peakDepth;
+   } ParallelSearchType;
+
+// prototypes
+
+/*
+Name: addSearchTask
+Process: appends task holding a copy of the current path to the task list,
+         growing the list and cell pool as needed, returns true 
+         if successful, false otherwise with the allocation failure noted
+Function Input/Parameters: pointer to task list (TaskListType *),
+                           current path (const SetType *),
+                           total of path (int), solved flag (bool)
+Function Output/Parameters: pointer to task list (TaskListType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: realloc, memcpy
+*/
+bool addSearchTask( TaskListType *taskList, const SetType *pathSet,
+                                           int runningTotal, bool solved );
+
+/*
+Name: buildTaskList
+Process: runs the serial search down to the split depth, recording each
+         path that reaches it as a task in serial order; a solution
+         found ahead of the split depth is recorded as a solved task and
+         ends the list since no later task can come first,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           split depth (int)
+Function Output/Parameters: pointer to search data with counts and peak
+                            depth updated (SearchContextType *),
+                            pointer to task list (TaskListType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: initializeSearchStack, checkLocation, continueSearch,
+              emptySet, clearSearchStack
+*/
+bool buildTaskList( SearchContextType *searchData, int splitDepth,
+                                                  TaskListType *taskList );
+
+/*
+Name: clearTaskList
+Process: releases heap memory held by task list, resets sizes to zero
+Function Input/Parameters: pointer to task list (TaskListType *)
+Function Output/Parameters: pointer to task list (TaskListType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearTaskList( TaskListType *taskList );
+
+/*
+Name: collectSearchTask
+Process: path visitor for buildTaskList, records path as a task,
+         returns true to keep splitting, false after a solved task
+         or a failed allocation
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           total of path (int),
+                           path result (ControlCodes)
+Function Output/Parameters: pointer to search data with task list
+                            in visit context (SearchContextType *)
+Function Output/Returned: continue flag (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: addSearchTask
+*/
+bool collectSearchTask( SearchContextType *searchData, int runningTotal,
+                                                   ControlCodes pathResult );
+
+/*
+Name: findSumParallel
+Process: splits the search into subtrees in serial search order, 
+         deepening the split until there are enough tasks to share,
+         then runs the tasks on worker threads that take the next task
+         as they finish one; a worker finding a solution cancels every
+         task after its own, and the lowest solved task wins, so the
+         solution is the one the serial search finds first,
+         search data counts are totals over all threads plus the
+         final split, and the peak depth is the deepest any thread
+         or the final split reached,
+         the calling thread works alongside the others and runs the
+         search alone when threads cannot be started,
+         falls back to findSumIterative if work cannot be allocated
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           number of threads to use (int)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: buildTaskList, clearTaskList, malloc, free, 
+              pthread_create, pthread_join, pthread_mutex_init,
+              pthread_mutex_destroy, runSearchWorker, addItem,
+              findSumIterative, atomic_init, atomic_load
+*/
+bool findSumParallel( SearchContextType *searchData, int threadCount );
+
+/*
+Name: getSearchThreadCount
+Process: returns number of online processors, 
+         limited to 1 through MAX_SEARCH_THREADS
+Function Input/Parameters: none
+Function Output/Parameters: none
+Function Output/Returned: thread count (int)
+Device Input/---: none
+Device Output/---: none
+Dependencies: sysconf
+*/
+int getSearchThreadCount();
+
+/*
+Name: runSearchTask
+Process: rebuilds a task's path in the worker's set and stack, 
+         then searches the subtree below it without restarting,
+         leaves the set holding the solution path when one is found,
+         returns true if a solution is found, false otherwise
+Function Input/Parameters: pointer to worker search data 
+                                                   (SearchContextType *),
+                           pointer to worker frame stack (SearchStackType *),
+                           pointer to task list (const TaskListType *),
+                           task index (int)
+Function Output/Parameters: pointer to worker search data 
+                                                   (SearchContextType *),
+                            pointer to worker frame stack (SearchStackType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: addItem, pushSearchFrame, continueSearch
+*/
+bool runSearchTask( SearchContextType *workerData, 
+                    SearchStackType *searchStack, 
+                    const TaskListType *taskList, int taskIndex );
+
+/*
+Name: runSearchWorker
+Process: thread body, takes tasks in order until none remain or every 
+         remaining task comes after a solved one, keeps the solution 
+         of the lowest solved task and adds its counts to the totals,
+         keeping the deepest level reached
+Function Input/Parameters: pointer to shared work data 
+                                          (ParallelSearchType * as void *)
+Function Output/Parameters: pointer to shared work data 
+                                          (ParallelSearchType * as void *)
+Function Output/Returned: NULL (void *)
+Device Input/---: none
+Device Output/---: none
+Dependencies: initializeGridSet, initializeSearchStack, runSearchTask,
+              emptySet, memcpy, clearSet, clearSearchStack,
+              pthread_mutex_lock, pthread_mutex_unlock, atomic_fetch_add,
+              atomic_load, atomic_store
+*/
+void *runSearchWorker( void *workPtr );
+
+#endif  // PARALLEL_SEARCH_UTILITY_H
@@ -1,12 +1,468 @@
 // included headers
 #include "RB_Utility.h"
+#include "Bitboard_Search_Utility.h"
+#include "Compact_Search_Utility.h"
+#include "Memo_Search_Utility.h"
+#include "Parallel_Search_Utility.h"
+#include "Segment_Search_Utility.h"
+#include "Sum_Reach_Utility.h"
+
+// dummy sink for accessTraceSink when not setting sink
+const TraceSinkType DUMMY_TRACE_SINK = { NULL, NULL };
+
+/*
+Name: accessTraceSink
+Process: allows setting or accessing the sink that receives trace output;
+         note: sink is maintained (static) value initialized to console
+Function Input/Parameters: control code (TraceControlCodes), 
+                           new sink (TraceSinkType),
+                           ignored if not setting sink
+Function Output/Parameters: none
+Function Output/Returned: current sink (TraceSinkType)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+TraceSinkType accessTraceSink( TraceControlCodes ctrlCode, 
+                                                     TraceSinkType newSink )
+   {
+    static TraceSinkType traceSink = { writeTraceToConsole, NULL };
+
+    if( ctrlCode == SET_TRACE_SINK )
+       {
+        traceSink = newSink;
+       }
+
+    return traceSink;
+   }
+
+/*
+Name: checkLocation
+Process: counts and reports attempt at location, keeping the deepest
+         recursion level tried, then tests it in order
+         for out of bounds, over sum, and already in set,
+         if valid, adds cell to set and updates running total,
+         a cell reaching the sum outside the bottom row is removed again,
+         with a prune table, a valid cell from which the sum cannot be
+         reached in the bottom row is counted and reported as pruned,
+         returns SOLUTION_FOUND if sum reached in bottom row,
+         VALID_ITEM if search continues from this cell,
+         PRUNED_BRANCH if cell is placed but has no useful continuation,
+         otherwise the reported failure code
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           pointer to working total (int *),
+                           x and y indices (int),
+                           recursion level for reporting (int)
+Function Output/Parameters: pointer to search data (SearchContextType *),
+                            pointer to working total (int *),
+                            pointer to tested cell (CellDataType *)
+Function Output/Returned: result of test (ControlCodes)
+Device Input/---: none
+Device Output/monitor: status of cell attempt
+Dependencies: setCellData, displayStatus, isInBounds, getArrayValue,
+              addItem, deleteItem, isSumReachable
+*/
+ControlCodes checkLocation( SearchContextType *searchData, int *runningTotal,
+                            int xIndex, int yIndex, int recLevel,
+                            CellDataType *current )
+   {
+    int totalBefore = *runningTotal;
+    bool verbose = searchData->verbose;
+    SetType *foundSet = searchData->foundSet;
+    CellDataType previous;
+    EntryDirections entryDirection = FROM_ABOVE;
+
+    // update iteration count and deepest level reached
+    searchData->iterationCount++;
+
+    if( recLevel > searchData->peakDepth )
+       {
+        searchData->peakDepth = recLevel;
+       }
+
+    // set working location, value is only read once in bounds
+    setCellData( current, 0, xIndex, yIndex );
+
+    TRACE_STATUS( recLevel, "Trying Location: ", 
+                                        *current, TEST_LOCATION, verbose );
+
+    if( !isInBounds( searchData->dataArray, xIndex, yIndex ) )
+       {
+        TRACE_STATUS( recLevel, "Location failed: ", 
+                                        *current, OUT_OF_BOUNDS, verbose );
+
+        return OUT_OF_BOUNDS;
+       }
+
+    current->dataValue = getArrayValue( searchData->dataArray, xIndex, yIndex );
+
+    *runningTotal += current->dataValue;
+
+    if( *runningTotal > searchData->sumRequest )
+       {
+        TRACE_STATUS( recLevel, "Location failed: ", 
+                                             *current, OVER_SUM, verbose );
+
+        return OVER_SUM;
+       }
+
+    if( !addItem( foundSet, *current ) )
+       {
+        TRACE_STATUS( recLevel, "Location failed: ", 
+                                       *current, DUPLICATE_ITEM, verbose );
+
+        return DUPLICATE_ITEM;
+       }
+
+    TRACE_STATUS( recLevel, "Valid Location found:", 
+                                           *current, VALID_ITEM, verbose );
+
+    if( *runningTotal == searchData->sumRequest )
+       {
+        if( xIndex == searchData->dataArray->rowSize - 1 )
+           {
+            return SOLUTION_FOUND;
+           }
+
+        deleteItem( foundSet, *current );
+
+        TRACE_STATUS( recLevel, "Location failed: ", 
+                                          *current, NO_SOLUTION, verbose );
+
+        return NO_SOLUTION;
+       }
+
+    if( searchData->pruneTable != NULL )
+       {
+        // direction of entry limits the rest of this row
+        if( foundSet->size > 1 )
+           {
+            previous = foundSet->setArray[ foundSet->size - 2 ];
+
+            if( previous.xLocation == xIndex )
+               {
+                entryDirection = previous.yLocation < yIndex 
+                                                 ? MOVING_RIGHT : MOVING_LEFT;
+               }
+           }
+
+        if( !isSumReachable( searchData->pruneTable, xIndex, yIndex, 
+                 entryDirection, totalBefore, searchData->sumRequest ) )
+           {
+            searchData->prunedCount++;
+
+            TRACE_STATUS( recLevel, "Location pruned: ", 
+                                        *current, PRUNED_BRANCH, verbose );
+
+            return PRUNED_BRANCH;
+           }
+       }
+
+    return VALID_ITEM;
+   }
+
+/*
+Name: clearArray
+Process: releases heap memory held by array, resets sizes to zero,
+         safe to call on an array that was never allocated
+Function Input/Parameters: pointer to array data (ArrayType *)
+Function Output/Parameters: pointer to array data (ArrayType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearArray( ArrayType *dataArray )
+   {
+    free( dataArray->array );
+
+    dataArray->array = NULL;
+
+    dataArray->rowSize = 0;
+
+    dataArray->colSize = 0;
+   }
+
+/*
+Name: clearPruneTable
+Process: releases heap memory held by prune table, resets sizes to zero,
+         safe to call on a table that was never allocated
+Function Input/Parameters: pointer to prune table (PruneTableType *)
+Function Output/Parameters: pointer to prune table (PruneTableType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearPruneTable( PruneTableType *pruneTable )
+   {
+    free( pruneTable->minRight );
+    free( pruneTable->minLeft );
+    free( pruneTable->maxRight );
+    free( pruneTable->maxLeft );
+    free( pruneTable->rowPrefix );
+
+    pruneTable->minRight = pruneTable->minLeft = NULL;
+    pruneTable->maxRight = pruneTable->maxLeft = NULL;
+    pruneTable->rowPrefix = NULL;
+
+    pruneTable->rowSize = pruneTable->colSize = 0;
+
+    pruneTable->allPositive = false;
+   }
+
+/*
+Name: clearSearchStack
+Process: releases heap memory held by frame stack, resets sizes to zero
+Function Input/Parameters: pointer to frame stack (SearchStackType *)
+Function Output/Parameters: pointer to frame stack (SearchStackType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearSearchStack( SearchStackType *searchStack )
+   {
+    free( searchStack->frames );
+
+    searchStack->frames = NULL;
+
+    searchStack->size = searchStack->capacity = 0;
+   }
+
+/*
+Name: closeTraceBuffer
+Process: flushes remaining buffered trace, closes trace file,
+         restores console trace sink,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to trace buffer (TraceBufferType *)
+Function Output/Parameters: pointer to trace buffer (TraceBufferType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/file: remaining trace written, file closed
+Dependencies: flushTraceBuffer, fclose, accessTraceSink
+*/
+bool closeTraceBuffer( TraceBufferType *traceBuffer )
+   {
+    TraceSinkType consoleSink = { writeTraceToConsole, NULL };
+    bool success;
+
+    if( traceBuffer->filePtr == NULL )
+       {
+        return false;
+       }
+
+    success = flushTraceBuffer( traceBuffer );
+
+    success = fclose( traceBuffer->filePtr ) == 0 && success;
+
+    traceBuffer->filePtr = NULL;
+
+    accessTraceSink( SET_TRACE_SINK, consoleSink );
+
+    return success;
+   }
+
+/*
+Name: continueSearch
+Process: iterative backtracking core, resolves a pending location result
+         and then tries right, down, left from the top frame until a
+         solution is found or the stack falls back to the base size;
+         an exhausted top row start restarts from the next top row cell
+         when the search data allows it, a visitor in the search data
+         receives each solution and each path reaching the split depth
+         and removes it to keep searching by returning true,
+         without a visitor a failed state table in the search data
+         skips known failed cells and keeps each exhausted frame,
+         a cancelled search stops early and returns false
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           pointer to frame stack (SearchStackType *),
+                           stack size to stop at (int),
+                           pending location result (ControlCodes),
+                           pending cell (CellDataType),
+                           total including pending cell (int)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *),
+                            pointer to frame stack (SearchStackType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/monitor: operation of backtracking
+Dependencies: checkLocation, displayStatus, deleteItem, pushSearchFrame,
+              atomic_load_explicit, getEntryDirection, isFailedState,
+              storeFailedState
+*/
+bool continueSearch( SearchContextType *searchData, 
+                     SearchStackType *searchStack, int baseSize, 
+                     ControlCodes locationResult, CellDataType current, 
+                     int runningTotal )
+   {
+    const int rowMoves[ SEARCH_MOVES ] = {  0, 1,  0 };
+    const int colMoves[ SEARCH_MOVES ] = {  1, 0, -1 };
+    int index;
+    SearchFrameType *topFrame;
+    FailedStateTableType *failedStates = searchData->visitPath == NULL
+                                         ? searchData->failedStates : NULL;
+    int colSize = searchData->dataArray->colSize;
+    bool found = false;
+
+    while( !found )
+       {
+        // stop once a search ahead of this one in order has succeeded
+        if( searchData->stopIndex != NULL
+              && ( searchData->iterationCount 
+                                & ( CANCEL_CHECK_INTERVAL - 1 ) ) == 0
+              && atomic_load_explicit( searchData->stopIndex, 
+                           memory_order_relaxed ) < searchData->taskIndex )
+           {
+            break;
+           }
+
+        // hand solutions and split depth paths to the visitor
+        if( searchData->visitPath != NULL
+              && ( locationResult == SOLUTION_FOUND 
+                    || ( locationResult == VALID_ITEM 
+                      && searchStack->size + 1 == searchData->splitDepth ) ) )
+           {
+            if( searchData->visitPath( searchData, 
+                                          runningTotal, locationResult ) )
+               {
+                deleteItem( searchData->foundSet, current );
+
+                locationResult = NO_SOLUTION;
+
+                // a visited start cell restarts like an exhausted one
+                if( searchStack->size == 0 && searchData->restartTopRow
+                      && current.yLocation < searchData->dataArray->colSize )
+                   {
+                    runningTotal = 0;
+
+                    locationResult = checkLocation( searchData, 
+                          &runningTotal, 0, current.yLocation + 1, 
+                                         searchStack->size + 1, &current );
+
+                    continue;
+                   }
+               }
+
+            else if( locationResult != SOLUTION_FOUND )
+               {
+                break;
+               }
+           }
+
+        // a state that failed before fails again, whatever path led here
+        if( failedStates != NULL && locationResult == VALID_ITEM 
+              && searchStack->size > 0
+              && isFailedState( failedStates, colSize, current, 
+                    getEntryDirection( searchStack->frames[ 
+                          searchStack->size - 1 ].current, current ),
+                                                           runningTotal ) )
+           {
+            deleteItem( searchData->foundSet, current );
+
+            TRACE_STATUS( searchStack->size + 1, "Location failed: ", 
+                                  current, NO_SOLUTION, searchData->verbose );
+
+            locationResult = NO_SOLUTION;
+           }
+
+        // valid item, push frame and continue from it,
+        // pruned item is pushed with no directions left to try
+        if( locationResult == VALID_ITEM || locationResult == PRUNED_BRANCH )
+           {
+            if( !pushSearchFrame( searchStack, current, runningTotal,
+                  locationResult == PRUNED_BRANCH ? SEARCH_MOVES : 0 ) )
+               {
+                break;
+               }
+           }
+
+        // solution found, report each frame as the recursion would unwind
+        else if( locationResult == SOLUTION_FOUND )
+           {
+            for( index = searchStack->size - 1; index >= 0; index-- )
+               {
+                TRACE_STATUS( index + 1, "Valid Location found:", 
+                                searchStack->frames[ index ].current, 
+                                        VALID_ITEM, searchData->verbose );
+               }
+
+            found = true;
+           }
+
+        // failed with no frame left to continue from, search is over
+        else if( searchStack->size <= baseSize )
+           {
+            break;
+           }
+
+        if( !found )
+           {
+            topFrame = &searchStack->frames[ searchStack->size - 1 ];
+
+            // try next direction from top frame
+            if( topFrame->nextMove < SEARCH_MOVES )
+               {
+                runningTotal = topFrame->runningTotal;
+
+                locationResult = checkLocation( searchData, &runningTotal,
+                      topFrame->current.xLocation 
+                                          + rowMoves[ topFrame->nextMove ],
+                      topFrame->current.yLocation 
+                                          + colMoves[ topFrame->nextMove ],
+                      searchStack->size + 1, &current );
+
+                topFrame->nextMove++;
+               }
+
+            // all directions failed, backtrack
+            else
+               {
+                deleteItem( searchData->foundSet, topFrame->current );
+
+                searchStack->size--;
+
+                if( failedStates != NULL && searchStack->size > 0 )
+                   {
+                    storeFailedState( failedStates, colSize, 
+                         topFrame->current, getEntryDirection( 
+                           searchStack->frames[ searchStack->size - 1 ]
+                                           .current, topFrame->current ),
+                                                   topFrame->runningTotal );
+                   }
+
+                // start over from next top row location
+                if( searchStack->size == 0 && searchData->restartTopRow
+                      && topFrame->current.yLocation 
+                                 < searchData->dataArray->colSize )
+                   {
+                    runningTotal = 0;
+
+                    locationResult = checkLocation( searchData, &runningTotal,
+                             0, topFrame->current.yLocation + 1,
+                             searchStack->size + 1, &current );
+                   }
+
+                else
+                   {
+                    TRACE_STATUS( searchStack->size + 1, "Location failed: ", 
+                      topFrame->current, NO_SOLUTION, searchData->verbose );
+
+                    locationResult = NO_SOLUTION;
+                   }
+               }
+           }
+       }
+
+    return found;
+   }
 
 /*
 Name: displayStatus
 Process: displays appropriately indented report of next attempt
          to place value, with ControlCodes as follows:
          VALID_ITEM, INVALID_ITEM, DUPLICATE_ITEM, OVER_SUM,
-         OUT_OF_BOUNDS, TEST_LOCATION, and NO_SOLUTION
+         OUT_OF_BOUNDS, TEST_LOCATION, NO_SOLUTION, and PRUNED_BRANCH
 Function Input/Parameters: recursion level for indentation (int),
                            status string reporting action (const char *),
                            cell data being tested (CellDataType),
@@ -16,75 +472,106 @@ Function Output/Parameters: none
 Function Output/Returned: none
 Device Input/---: none
 Device Output/monitor: status of cell attempt
-Dependencies: printf, cellToString
+Dependencies: sprintf, cellToString, accessTraceSink
 */
 void displayStatus( int recLevel, const char *status, CellDataType current,
                                       ControlCodes opSuccess, bool verboseFlag )
    {
-    int index, recLevelIndent = recLevel * REC_LEVEL_INDENT;
+    int recLevelIndent = recLevel * REC_LEVEL_INDENT, chunkSize;
     char tempStr[ STD_STR_LEN ];
+    char outStr[ MAX_STR_LEN ];
+    char spaces[ TRACE_INDENT_CHUNK ];
+    TraceSinkType traceSink;
 
     if( verboseFlag )
        {
-        for( index = 0; index < recLevelIndent; index++ )
+        traceSink = accessTraceSink( GET_TRACE_SINK, DUMMY_TRACE_SINK );
+
+        // write indentation in blocks rather than one space at a time
+        memset( spaces, SPACE, TRACE_INDENT_CHUNK );
+
+        while( recLevelIndent > 0 )
            {
-            printf( "%c", SPACE );
+            chunkSize = recLevelIndent < TRACE_INDENT_CHUNK 
+                                        ? recLevelIndent : TRACE_INDENT_CHUNK;
+
+            traceSink.writeTrace( traceSink.context, spaces, chunkSize );
+
+            recLevelIndent -= chunkSize;
            }
-     
-        printf( "%s", status );
+
+        tempStr[ 0 ] = NULL_CHAR;
      
         if( opSuccess == TEST_LOCATION )
            {
-            printf( "(%d, %d)\n", current.xLocation, current.yLocation );
+            sprintf( tempStr, "(%d, %d)", 
+                                       current.xLocation, current.yLocation );
            }
          
         else if( opSuccess == OUT_OF_BOUNDS )
            {
-            printf( "Location Not Found\n" );
+            sprintf( tempStr, "Location Not Found" );
            }
      
         else if( opSuccess == VALID_ITEM )
            {
             cellToString( tempStr, current );
-            printf( "%s\n", tempStr );
            }
          
         else if( opSuccess == NO_SOLUTION )
            {
-            printf( "Doesn't Support Solution\n" );
+            sprintf( tempStr, "Doesn't Support Solution" );
            }
 
         else if( opSuccess == DUPLICATE_ITEM )
            {
-            printf( "Already In Set\n" );
+            sprintf( tempStr, "Already In Set" );
            }
          
         else if( opSuccess == OVER_SUM )
            {
-            printf( "Over Requested Sum\n" );
+            sprintf( tempStr, "Over Requested Sum" );
            }
+
+        else if( opSuccess == PRUNED_BRANCH )
+           {
+            sprintf( tempStr, "Sum Out Of Reach" );
+           }
+
+        // unknown codes print the status line only, as before
+        else
+           {
+            traceSink.writeTrace( traceSink.context, status, 
+                                                         (int)strlen( status ) );
+
+            return;
+           }
+
+        traceSink.writeTrace( traceSink.context, outStr,
+                                  sprintf( outStr, "%s%s\n", status, tempStr ) );
        }
    }
 
 /*
 Name: dumpArray
 Process: simple 2D array dump of array data
-Function Input/Parameters: array data (ArrayType), title (const char *)
+Function Input/Parameters: title (const char *),
+                           pointer to array data (const ArrayType *)
 Function Output/Parameters: none
 Function Output/Returned: none
 Device Input/---: none
 Device Output/monitor: display of 2D array
-Dependencies: printf
+Dependencies: printf, getArrayValue
 */
-void dumpArray( const char *title, const ArrayType dispArray )
+void dumpArray( const char *title, const ArrayType *dispArray )
    {
     int rowIndex, colIndex;
 
     printf( "\n%s\n", title );
 
-    for( rowIndex = 0; rowIndex < dispArray.rowSize; rowIndex++ )
+    for( rowIndex = 0; rowIndex < dispArray->rowSize; rowIndex++ )
        {
-        for( colIndex = 0; colIndex < dispArray.colSize; colIndex++ )
+        for( colIndex = 0; colIndex < dispArray->colSize; colIndex++ )
            {
             if( colIndex > 0 )
                {
@@ -92,7 +579,7 @@ void dumpArray( const char *title, const ArrayType dispArray )
 
                }
           
-            printf( "%5d", dispArray.array[ rowIndex ][ colIndex ] );
+            printf( "%5d", getArrayValue( dispArray, rowIndex, colIndex ) );
            }
       
         printf( "\n" );
@@ -101,6 +588,134 @@ void dumpArray( const char *title, const ArrayType dispArray )
     printf( "\n" );
    }
 
+/*
+Name: findAllSums
+Process: searches every top row start for every path that adds up 
+         to the requested sum, ending at the first bottom row cell 
+         that reaches it as findSum does, and streams each one to the 
+         solution handler as it is found without storing it;
+         a NULL handler only counts solutions,
+         unlike findSum a start cell that fails does not end the search,
+         returns true if the search completed, false if the handler 
+         stopped it or memory could not be allocated
+Function Input/Parameters: pointer to data array (const ArrayType *),
+                           pointer to prune table (const PruneTableType *),
+                           NULL searches without pruning,
+                           value to sum up to (int),
+                           pointer to solution stream with handler and 
+                           its context (SolutionStreamType *)
+Function Output/Parameters: pointer to solution stream with solution
+                            and iteration counts (SolutionStreamType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: initializeGridSet, initializeSearchStack, 
+              initializeSearchContext, checkLocation, continueSearch,
+              visitSolution, deleteItem, clearSearchStack, clearSet
+*/
+bool findAllSums( const ArrayType *dataArray, 
+                  const PruneTableType *pruneTable, int sumRequest,
+                  SolutionStreamType *solutionStream )
+   {
+    int startColumn, runningTotal;
+    SetType foundSet;
+    SearchContextType searchData;
+    SearchStackType searchStack;
+    CellDataType current;
+    ControlCodes locationResult;
+    bool completed = true;
+
+    solutionStream->solutionCount = 0;
+    solutionStream->iterationCount = 0;
+
+    if( !initializeGridSet( &foundSet, dataArray->rowSize, 
+                                                     dataArray->colSize ) )
+       {
+        clearSet( &foundSet );
+
+        return false;
+       }
+
+    if( !initializeSearchStack( &searchStack ) )
+       {
+        clearSet( &foundSet );
+
+        return false;
+       }
+
+    initializeSearchContext( &searchData, dataArray, pruneTable,
+                                            &foundSet, sumRequest, false );
+
+    searchData.visitPath = visitSolution;
+    searchData.visitContext = solutionStream;
+    searchData.restartTopRow = false;
+
+    for( startColumn = 0; completed && startColumn < dataArray->colSize;
+                                                             startColumn++ )
+       {
+        runningTotal = 0;
+
+        locationResult = checkLocation( &searchData, &runningTotal, 
+                                           0, startColumn, 1, &current );
+
+        // search ends early only when stopped or out of stack space
+        completed = !continueSearch( &searchData, &searchStack, 0,
+                                   locationResult, current, runningTotal )
+                                                 && searchStack.size == 0;
+       }
+
+    solutionStream->iterationCount = searchData.iterationCount;
+
+    clearSearchStack( &searchStack );
+
+    clearSet( &foundSet );
+
+    return completed;
+   }
+
+/*
+Name: findBoundsBelow
+Process: finds lowest and highest total that can follow a cell
+         by moving down from it, in the bottom row the path may stop
+         so the bounds are zero, otherwise the bounds of entering
+         the cell below in either direction
+Function Input/Parameters: pointer to prune table (const PruneTableType *),
+                           row and column index (int), bottom row flag (bool)
+Function Output/Parameters: lowest and highest total (long long *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+void findBoundsBelow( const PruneTableType *pruneTable, 
+                      int rowIndex, int colIndex, bool bottomRow,
+                      long long *lowBelow, long long *highBelow )
+   {
+    size_t belowIndex;
+
+    if( bottomRow )
+       {
+        *lowBelow = 0;
+
+        *highBelow = 0;
+       }
+
+    else
+       {
+        belowIndex = (size_t)( rowIndex + 1 ) * pruneTable->colSize + colIndex;
+
+        *lowBelow = pruneTable->minRight[ belowIndex ] 
+                                     < pruneTable->minLeft[ belowIndex ]
+                    ? pruneTable->minRight[ belowIndex ] 
+                                     : pruneTable->minLeft[ belowIndex ];
+
+        *highBelow = pruneTable->maxRight[ belowIndex ] 
+                                     > pruneTable->maxLeft[ belowIndex ]
+                     ? pruneTable->maxRight[ belowIndex ] 
+                                     : pruneTable->maxLeft[ belowIndex ];
+       }
+   }
+
 /*
 Name: findSum
 Process: Calls helper to find contiguous values
@@ -130,32 +745,58 @@ Process: Calls helper to find contiguous values
          - The method must be able to handle the condition
            that the value in the upper left corner does not support the solution 
 
-Function Input/Parameters: data array (ArrayType),
+Function Input/Parameters: pointer to data array (const ArrayType *),
+                           pointer to prune table (const PruneTableType *),
+                           NULL searches without pruning,
                            value to sum up to (int), 
+                           search engine (SearchModes: RECURSIVE_SEARCH,
+                           ITERATIVE_SEARCH, PARALLEL_SEARCH which
+                           finds the same solution without tracing,
+                           REACHABILITY_SEARCH which finds any solution
+                           without backtracking or tracing, trying
+                           every top row start where the others stop
+                           at the first start cell that fails,
+                           MEMOIZED_SEARCH which finds the same solution
+                           skipping known failed states, or
+                           SEGMENT_SEARCH which finds the same solution
+                           a row segment at a time without tracing),
+                           ITERATIVE_SEARCH of a grid with at most
+                           BITBOARD_CELLS cells runs as BITBOARD_SEARCH,
+                           the same search with the set held in bits,
                            verbose flag controls description(bool)
 Function Output/Parameters: none
 Function Output/Returned: none
 Device Input/---: none
 Device Output/monitor: display of process
-Dependencies: initializeSet, printf, findSumHelper, displaySet
+Dependencies: initializeGridSet, initializeSearchContext, printf, 
+              isBitboardGrid, runSearch, displaySet, clearSet
 
   */
-void findSum( const ArrayType dataArray, int sumRequest, bool verbose )
+void findSum( const ArrayType *dataArray, const PruneTableType *pruneTable,
+                     int sumRequest, SearchModes searchMode, bool verbose )
     {
-     int startingXIndex = 0, startingYIndex = 0;
-     int startingTotal = 0, startingRecLevel = 0;
-     int iterationCount = 0;
      int index, testSum = 0;
+     bool success;
      SetType foundSet;
+     SearchContextType searchData;
+
+     // bitmap allocation failure leaves a plain set, searched linearly
+     initializeGridSet( &foundSet, dataArray->rowSize, dataArray->colSize );
 
-     initializeSet( &foundSet );
+     initializeSearchContext( &searchData, dataArray, pruneTable,
+                                         &foundSet, sumRequest, verbose );
      
      printf( "Search for sum %d, start: \n\n", sumRequest );
 
-     if( findSumHelper( sumRequest, startingTotal,
-                        startingXIndex, startingYIndex, 
-                        &foundSet, dataArray,
-                        startingRecLevel, &iterationCount, verbose ) )
+     // small grids search the same way with the visited set in bits
+     if( searchMode == ITERATIVE_SEARCH && isBitboardGrid( dataArray ) )
+        {
+         searchMode = BITBOARD_SEARCH;
+        }
+
+     success = runSearch( &searchData, searchMode );
+
+     if( success )
         {
          displaySet( "\nSearch End => Successful Set:", foundSet );
 
@@ -165,116 +806,77 @@ void findSum( const ArrayType dataArray, int sumRequest, bool verbose )
             }
 
          printf( "\nSum Verified   : %d\n", testSum );
-
-         printf( "\nIteration Count: %d\n", iterationCount );
         }
      
      else
        {
         printf( "\nSearch End => Solution Not Found\n" );
-
-        printf( "\nIteration Count: %d\n", iterationCount );
        }  
+
+     printf( "\nIteration Count: %d\n", searchData.iterationCount );
+
+     if( pruneTable != NULL )
+        {
+         printf( "Pruned Count   : %d\n", searchData.prunedCount );
+        }
+
+     if( searchData.memoLookupCount > 0 )
+        {
+         printf( "Memo Hits      : %lld of %lld lookups (%.1f%%)\n",
+                 searchData.memoHitCount, searchData.memoLookupCount,
+                 100.0 * searchData.memoHitCount 
+                                          / searchData.memoLookupCount );
+        }
+
+     clearSet( &foundSet );
     }
  
 /*
 Name: findSumHelper
 Process: specifications in calling function
-Function Input/Parameters: sum value result requested (int),
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           holding sum requested, resulting set, data array,
+                           prune table, counts, and verbose flag,
                            starting and then working total (int),
                            starting x and y indices (int),
-                           pointer toresulting set (SetType *), 
-                           data array (const ArrayType)
-                           starting and then working recursion level (int),
-                           pointer to iteration count (int *)
-                           verbose flag (bool)
-Function Output/Parameters: pointer to iteration count to be returned (int *)
+                           starting and then working recursion level (int)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts to be returned (SearchContextType *)
 Function Output/Returned: result of given attempt (bool)
 Device Input/---: none
 Device Output/monitor: operation of recursive backtracking
-Dependencies: setCellData, displayStatus, isInBounds, isInSet, 
-              addItem, findSumHelper (recursive),
+Dependencies: checkLocation, displayStatus, deleteItem, 
+              findSumHelper (recursive),
               other functions in this file are allowed,
               Note: displayStatus is used exclusively, 
               no other printing functions are allowed
 */
-bool findSumHelper( int sumRequest, int runningTotal,
-                    int xIndex, int yIndex, 
-                    SetType *foundSet, const ArrayType dataArray,
-                    int recLevel, int *iterationCount, 
-                    bool verbose )
+bool findSumHelper( SearchContextType *searchData, int runningTotal,
+                    int xIndex, int yIndex, int recLevel )
    {
 	 //intinalzie vars
-	 char status[STD_STR_LEN] ;
 	 CellDataType current ; 
+	 ControlCodes locationResult ;
 		
 		recLevel++; 
 		
-	 // update iteration count
-		*iterationCount = *iterationCount +1 ; 
-		
-    // find working value
-		//display status of location
-		setCellData( &current , 
-		dataArray.array[xIndex][yIndex], xIndex, yIndex);
-		sprintf(status,"Trying Location: ");
-			displayStatus( recLevel, status,  current,
-					TEST_LOCATION,  verbose ) ;
-		
-       // check for not in bounds
-		if (!isInBounds(  dataArray, xIndex, yIndex ))
-		{
-			sprintf(status, "Location failed: "); 
-          // report failure, return false
-			displayStatus( recLevel, status,  current,
-					OUT_OF_BOUNDS,  verbose );
-		 //return false
-		 return false ; 
-		}
-	
-		 
-       // add the value to runningTotal
-			runningTotal+= dataArray.array[xIndex][yIndex] ; 
-       // check for over the sumRequest
-		if( runningTotal > sumRequest) 
+    // test the location, adding it to the set if it is valid
+		locationResult = checkLocation( searchData, &runningTotal,
+                        xIndex, yIndex, recLevel, &current ) ;
+
+       // check for at bottom row with sumRequest
+		if( locationResult == SOLUTION_FOUND )
 		{
-			
-			sprintf(status, "Location failed: ");  
-          // report failure, return false
-			displayStatus( recLevel, status,  current,
-					OVER_SUM,  verbose );
-			return false ;
+          // return true
+			return true ; 
 		}
-       // add the item, check for failure
-		if(!addItem( foundSet, current ))
+
+       // check for failed location, already reported,
+       // pruned cells are placed but not searched past
+		if( locationResult != VALID_ITEM 
+                                  && locationResult != PRUNED_BRANCH )
 		{
-			sprintf(status, "Location failed: ");  
-          // report failure, return false
-			displayStatus( recLevel, status,  current,
-					DUPLICATE_ITEM,  verbose );
 			return false ;
-  
-		}
-		sprintf(status, "Valid Location found:"); 
-       // report valid item
-		displayStatus( recLevel, status,  current,
-					VALID_ITEM,  verbose);
-       // check for at sumRequest 
-		if( runningTotal == sumRequest)
-		{
-           // check for at bottom row
-			if( xIndex == dataArray.rowSize - 1 )
-			{
-              // return true
-				return true ; 
-			}
-           // remove from set
-			 deleteItem(foundSet , current);
-			sprintf(status, "Location failed: "); 
-           // report failure, return false
-			displayStatus( recLevel, status,  current,
-					NO_SOLUTION,  verbose ) ;
-			return false ; 
 		}
 		
 ////////////////////////////////////////////////////// I have a valid item
@@ -283,46 +885,38 @@ bool findSumHelper( int sumRequest, int runningTotal,
 			
 
        // check for success to the right
-		if(findSumHelper( sumRequest,runningTotal,
-                        xIndex, yIndex+1, 
-                        foundSet, dataArray,
-                        recLevel, iterationCount, verbose ))
+		if( locationResult == VALID_ITEM 
+                     && findSumHelper( searchData, runningTotal,
+                        xIndex, yIndex+1, recLevel ))
 		{
 			
-			sprintf(status, "Valid Location found:"); 
 			// report valid item
-			displayStatus( recLevel, status,  current,
-					VALID_ITEM,  verbose);
+			TRACE_STATUS( recLevel, "Valid Location found:",  current,
+					VALID_ITEM,  searchData->verbose);
           // return true  
 		  return true ; 
 		}
        // check for success down
-		if(findSumHelper( sumRequest,runningTotal,
-                        xIndex+1, yIndex, 
-                        foundSet, dataArray,
-                        recLevel, iterationCount, verbose ))
+		if( locationResult == VALID_ITEM 
+                     && findSumHelper( searchData, runningTotal,
+                        xIndex+1, yIndex, recLevel ))
 		{
 			
-          // report found
-			sprintf(status, "Valid Location found:"); 
        // report valid item
-			displayStatus( recLevel, status,  current,
-					VALID_ITEM,  verbose);
+			TRACE_STATUS( recLevel, "Valid Location found:",  current,
+					VALID_ITEM,  searchData->verbose);
           // return true  
 		  return true ;
 		}
        // check for success to the left
-		if(findSumHelper( sumRequest,runningTotal,
-                        xIndex, yIndex-1, 
-                        foundSet, dataArray,
-                        recLevel, iterationCount, verbose ))
+		if( locationResult == VALID_ITEM 
+                     && findSumHelper( searchData, runningTotal,
+                        xIndex, yIndex-1, recLevel ))
 		{
 			
-          // report found
-			sprintf(status, "Valid Location found:"); 
        // report valid item
-			displayStatus( recLevel, status,  current,
-					VALID_ITEM,  verbose);
+			TRACE_STATUS( recLevel, "Valid Location found:",  current,
+					VALID_ITEM,  searchData->verbose);
           // return true 
 			return true ; 
 		}
@@ -331,50 +925,752 @@ bool findSumHelper( int sumRequest, int runningTotal,
     // clean up and quit
 		 
        // remove the cell from the set
-		deleteItem( foundSet,  current ) ; 
+		deleteItem( searchData->foundSet,  current ) ; 
 		
        // check for recLevel zero AND not off the right end
-		if(recLevel == 1 && yIndex < dataArray.colSize )
+		if(recLevel == 1 && yIndex < searchData->dataArray->colSize )
 		{
           // reset everything
 			runningTotal = 0;
 			recLevel = 0 ; 
-			// start over with recursion to the next one over
-			findSumHelper( sumRequest,runningTotal,
-                        xIndex, yIndex+1, 
-                        foundSet, dataArray,
-                        recLevel, iterationCount, verbose );
-			return false ; 
+			// start over with recursion to the next one over,
+			// its result is the result of the whole search
+			return findSumHelper( searchData, runningTotal,
+                        xIndex, yIndex+1, recLevel );
 			
 		}
           
 		  
 
-		sprintf(status, "Location failed: ");   
            // report failure, return false
-			displayStatus( recLevel, status,  current,
-					NO_SOLUTION,  verbose ) ;
+			TRACE_STATUS( recLevel, "Location failed: ",  current,
+					NO_SOLUTION,  searchData->verbose ) ;
 	
     // return false		
     return false;  
    }
+
+/*
+Name: findSumIterative
+Process: same search as findSumHelper with the same right, down, left
+         order, report and iteration count, but keeps the path in a
+         heap allocated frame stack instead of recursion so path length
+         is not limited by the native stack,
+         returns false if no solution or the frame stack cannot grow
+Function Input/Parameters: pointer to search data (SearchContextType *)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/monitor: operation of backtracking
+Dependencies: checkLocation, continueSearch, initializeSearchStack, 
+              clearSearchStack
+*/
+bool findSumIterative( SearchContextType *searchData )
+   {
+    int runningTotal = 0;
+    SearchStackType searchStack;
+    CellDataType current;
+    ControlCodes locationResult;
+    bool found;
+
+    if( !initializeSearchStack( &searchStack ) )
+       {
+        return false;
+       }
+
+    locationResult = checkLocation( searchData, &runningTotal, 0, 0,
+                                                           1, &current );
+
+    found = continueSearch( searchData, &searchStack, 0, 
+                                   locationResult, current, runningTotal );
+
+    clearSearchStack( &searchStack );
+
+    return found;
+   }
  
+/*
+Name: flushTraceBuffer
+Process: writes buffered trace text to trace file, empties buffer,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to trace buffer (TraceBufferType *)
+Function Output/Parameters: pointer to trace buffer (TraceBufferType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/file: buffered trace written
+Dependencies: fwrite
+*/
+bool flushTraceBuffer( TraceBufferType *traceBuffer )
+   {
+    bool success = traceBuffer->filePtr != NULL 
+              && fwrite( traceBuffer->buffer, 1, traceBuffer->used, 
+                         traceBuffer->filePtr ) == (size_t)traceBuffer->used;
+
+    traceBuffer->used = 0;
+
+    return success;
+   }
+
+/*
+Name: getArrayValue
+Process: returns value stored at given row and column,
+         indices are assumed to be in bounds
+Function Input/Parameters: pointer to array data (const ArrayType *),
+                           row and column indices (int)
+Function Output/Parameters: none
+Function Output/Returned: value at location (int)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+int getArrayValue( const ArrayType *dataArray, int rowIndex, int colIndex )
+   {
+    return dataArray->array[ (size_t)rowIndex * dataArray->colSize + colIndex ];
+   }
+
+/*
+Name: hasPrefixValue
+Process: binary search of strictly increasing prefix sums 
+         between low and high indices, inclusive
+Function Input/Parameters: prefix sums (const long long *),
+                           low and high indices (int), search value (long long)
+Function Output/Parameters: none
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+bool hasPrefixValue( const long long *prefix, 
+                             int lowIndex, int highIndex, long long searchVal )
+   {
+    int midIndex;
+
+    while( lowIndex <= highIndex )
+       {
+        midIndex = lowIndex + ( highIndex - lowIndex ) / 2;
+
+        if( prefix[ midIndex ] == searchVal )
+           {
+            return true;
+           }
+
+        if( prefix[ midIndex ] < searchVal )
+           {
+            lowIndex = midIndex + 1;
+           }
+
+        else
+           {
+            highIndex = midIndex - 1;
+           }
+       }
+
+    return false;
+   }
+
+/*
+Name: initializeArray
+Process: allocates contiguous row-major storage for given dimensions,
+         returns true if successful, false for invalid sizes
+         or failed allocation (array is left empty)
+Function Input/Parameters: number of rows and columns (int)
+Function Output/Parameters: pointer to array data (ArrayType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: malloc
+*/
+bool initializeArray( ArrayType *dataArray, int rowSize, int colSize )
+   {
+    dataArray->array = NULL;
+    dataArray->rowSize = 0;
+    dataArray->colSize = 0;
+
+    if( rowSize > 0 && colSize > 0 
+                            && (size_t)rowSize <= SIZE_MAX / sizeof( int ) 
+                                                              / (size_t)colSize )
+       {
+        dataArray->array 
+                  = malloc( (size_t)rowSize * (size_t)colSize * sizeof( int ) );
+       }
+
+    if( dataArray->array != NULL )
+       {
+        dataArray->rowSize = rowSize;
+
+        dataArray->colSize = colSize;
+
+        return true;
+       }
+
+    return false;
+   }
+
+/*
+Name: initializePruneTable
+Process: preprocessing pass over data array for pruning,
+         row prefix sums, then from the bottom row up, the lowest and
+         highest total of any path from each cell (including its value)
+         to a stop in the bottom row that continues right or left through
+         the cell's row before moving down, totals saturate at int limits,
+         returns true if successful, false for failed allocation
+         (table is left empty)
+Function Input/Parameters: pointer to data array (const ArrayType *)
+Function Output/Parameters: pointer to prune table (PruneTableType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: malloc, getArrayValue, clearPruneTable
+*/
+bool initializePruneTable( PruneTableType *pruneTable, 
+                                                const ArrayType *dataArray )
+   {
+    int rowIndex, colIndex, rowSize = dataArray->rowSize;
+    int colSize = dataArray->colSize, value;
+    size_t numCells = (size_t)rowSize * colSize, cellIndex;
+    long long lowBelow, highBelow, lowTotal, highTotal;
+    bool bottomRow;
+
+    pruneTable->minRight = malloc( numCells * sizeof( int ) );
+    pruneTable->minLeft = malloc( numCells * sizeof( int ) );
+    pruneTable->maxRight = malloc( numCells * sizeof( int ) );
+    pruneTable->maxLeft = malloc( numCells * sizeof( int ) );
+    pruneTable->rowPrefix 
+          = malloc( (size_t)rowSize * ( colSize + 1 ) * sizeof( long long ) );
+
+    pruneTable->rowSize = rowSize;
+    pruneTable->colSize = colSize;
+    pruneTable->allPositive = true;
+
+    if( pruneTable->minRight == NULL || pruneTable->minLeft == NULL
+          || pruneTable->maxRight == NULL || pruneTable->maxLeft == NULL
+          || pruneTable->rowPrefix == NULL )
+       {
+        clearPruneTable( pruneTable );
+
+        return false;
+       }
+
+    for( rowIndex = rowSize - 1; rowIndex >= 0; rowIndex-- )
+       {
+        bottomRow = rowIndex == rowSize - 1;
+
+        pruneTable->rowPrefix[ (size_t)rowIndex * ( colSize + 1 ) ] = 0;
+
+        for( colIndex = 0; colIndex < colSize; colIndex++ )
+           {
+            value = getArrayValue( dataArray, rowIndex, colIndex );
+
+            if( value <= 0 )
+               {
+                pruneTable->allPositive = false;
+               }
+
+            pruneTable->rowPrefix[ (size_t)rowIndex * ( colSize + 1 ) 
+                                                         + colIndex + 1 ]
+                = pruneTable->rowPrefix[ (size_t)rowIndex * ( colSize + 1 ) 
+                                                         + colIndex ] + value;
+           }
+
+        // sweep right to left for paths heading right
+        for( colIndex = colSize - 1; colIndex >= 0; colIndex-- )
+           {
+            cellIndex = (size_t)rowIndex * colSize + colIndex;
+
+            findBoundsBelow( pruneTable, rowIndex, colIndex, bottomRow,
+                                                    &lowBelow, &highBelow );
+
+            if( colIndex + 1 < colSize )
+               {
+                lowBelow = lowBelow < pruneTable->minRight[ cellIndex + 1 ] 
+                             ? lowBelow : pruneTable->minRight[ cellIndex + 1 ];
+
+                highBelow = highBelow > pruneTable->maxRight[ cellIndex + 1 ]
+                            ? highBelow : pruneTable->maxRight[ cellIndex + 1 ];
+               }
+
+            value = getArrayValue( dataArray, rowIndex, colIndex );
+
+            lowTotal = lowBelow + value;
+            highTotal = highBelow + value;
+
+            pruneTable->minRight[ cellIndex ] = lowTotal < INT_MIN ? INT_MIN 
+                           : ( lowTotal > INT_MAX ? INT_MAX : (int)lowTotal );
+
+            pruneTable->maxRight[ cellIndex ] = highTotal > INT_MAX ? INT_MAX 
+                         : ( highTotal < INT_MIN ? INT_MIN : (int)highTotal );
+           }
+
+        // sweep left to right for paths heading left
+        for( colIndex = 0; colIndex < colSize; colIndex++ )
+           {
+            cellIndex = (size_t)rowIndex * colSize + colIndex;
+
+            findBoundsBelow( pruneTable, rowIndex, colIndex, bottomRow,
+                                                    &lowBelow, &highBelow );
+
+            if( colIndex > 0 )
+               {
+                lowBelow = lowBelow < pruneTable->minLeft[ cellIndex - 1 ] 
+                              ? lowBelow : pruneTable->minLeft[ cellIndex - 1 ];
+
+                highBelow = highBelow > pruneTable->maxLeft[ cellIndex - 1 ]
+                             ? highBelow : pruneTable->maxLeft[ cellIndex - 1 ];
+               }
+
+            value = getArrayValue( dataArray, rowIndex, colIndex );
+
+            lowTotal = lowBelow + value;
+            highTotal = highBelow + value;
+
+            pruneTable->minLeft[ cellIndex ] = lowTotal < INT_MIN ? INT_MIN 
+                           : ( lowTotal > INT_MAX ? INT_MAX : (int)lowTotal );
+
+            pruneTable->maxLeft[ cellIndex ] = highTotal > INT_MAX ? INT_MAX 
+                         : ( highTotal < INT_MIN ? INT_MIN : (int)highTotal );
+           }
+       }
+
+    return true;
+   }
+
+/*
+Name: initializeSearchContext
+Process: sets search data for a plain first solution search from the top
+         left cell, with counts zeroed and no compact grid,
+         visitor, or cancellation
+Function Input/Parameters: pointer to data array (const ArrayType *),
+                           pointer to prune table or NULL 
+                                                  (const PruneTableType *),
+                           pointer to working set (SetType *),
+                           sum requested (int), verbose flag (bool)
+Function Output/Parameters: pointer to search data (SearchContextType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+void initializeSearchContext( SearchContextType *searchData, 
+                        const ArrayType *dataArray, 
+                        const PruneTableType *pruneTable, SetType *foundSet,
+                        int sumRequest, bool verbose )
+   {
+    searchData->dataArray = dataArray;
+    searchData->pruneTable = pruneTable;
+    searchData->compactGrid = NULL;
+    searchData->foundSet = foundSet;
+    searchData->sumRequest = sumRequest;
+    searchData->iterationCount = 0;
+    searchData->prunedCount = 0;
+    searchData->peakDepth = 0;
+    searchData->verbose = verbose;
+    searchData->visitPath = NULL;
+    searchData->visitContext = NULL;
+    searchData->splitDepth = 0;
+    searchData->stopIndex = NULL;
+    searchData->taskIndex = 0;
+    searchData->restartTopRow = true;
+    searchData->failedStates = NULL;
+    searchData->memoLookupCount = 0;
+    searchData->memoHitCount = 0;
+   }
+
+/*
+Name: initializeSearchStack
+Process: allocates frame stack at its starting capacity, 
+         returns true if successful, false otherwise
+Function Input/Parameters: none
+Function Output/Parameters: pointer to frame stack (SearchStackType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: malloc
+*/
+bool initializeSearchStack( SearchStackType *searchStack )
+   {
+    searchStack->size = 0;
+    searchStack->capacity = FRAME_STACK_START;
+
+    searchStack->frames 
+           = malloc( searchStack->capacity * sizeof( SearchFrameType ) );
+
+    if( searchStack->frames == NULL )
+       {
+        searchStack->capacity = 0;
+
+        return false;
+       }
+
+    return true;
+   }
+
 /*
 Name: isInBounds
-Process: tests x and y locations for in array bounds
+Process: tests x (row) and y (column) locations for in array bounds
 Function Input/Parameters: x & y locations (int),
-                           data array (ArrayType)
+                           pointer to data array (const ArrayType *)
 Function Output/Parameters: none
 Function Output/Returned: result of test (bool)
 Device Input/---: none
 Device Output/---: none
 Dependencies: none
 */
-bool isInBounds( ArrayType dataArray, int xLocTest, int yLocTest )
+bool isInBounds( const ArrayType *dataArray, int xLocTest, int yLocTest )
    {
-    bool rowTest = xLocTest >= 0 && xLocTest < dataArray.colSize;
-    bool colTest = yLocTest >= 0 && yLocTest < dataArray.rowSize;
+    bool rowTest = xLocTest >= 0 && xLocTest < dataArray->rowSize;
+    bool colTest = yLocTest >= 0 && yLocTest < dataArray->colSize;
      
     return rowTest && colTest;
    }
- 
+
+/*
+Name: isSumReachable
+Process: tests whether a path placed at a cell can still end in the
+         bottom row at the requested sum, using the bounds for the
+         directions still open in the cell's row (both from above,
+         otherwise only the direction of travel), in the bottom row
+         of an all positive array the remaining segment sums are
+         matched exactly with a binary search of the row prefix sums
+Function Input/Parameters: pointer to prune table (const PruneTableType *),
+                           x and y indices (int), 
+                           direction cell was entered (EntryDirections),
+                           total before this cell (int), sum requested (int)
+Function Output/Parameters: none
+Function Output/Returned: result of test (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: hasPrefixValue
+*/
+bool isSumReachable( const PruneTableType *pruneTable, 
+                     int xIndex, int yIndex, EntryDirections entryDirection,
+                     int totalBefore, int sumRequest )
+   {
+    int colSize = pruneTable->colSize;
+    size_t cellIndex = (size_t)xIndex * colSize + yIndex;
+    long long lowTotal, highTotal, needed = (long long)sumRequest - totalBefore;
+    const long long *prefix;
+
+    if( entryDirection == MOVING_RIGHT )
+       {
+        lowTotal = pruneTable->minRight[ cellIndex ];
+        highTotal = pruneTable->maxRight[ cellIndex ];
+       }
+
+    else if( entryDirection == MOVING_LEFT )
+       {
+        lowTotal = pruneTable->minLeft[ cellIndex ];
+        highTotal = pruneTable->maxLeft[ cellIndex ];
+       }
+
+    else
+       {
+        lowTotal = pruneTable->minRight[ cellIndex ] 
+                                         < pruneTable->minLeft[ cellIndex ]
+                   ? pruneTable->minRight[ cellIndex ] 
+                                         : pruneTable->minLeft[ cellIndex ];
+
+        highTotal = pruneTable->maxRight[ cellIndex ] 
+                                         > pruneTable->maxLeft[ cellIndex ]
+                    ? pruneTable->maxRight[ cellIndex ] 
+                                         : pruneTable->maxLeft[ cellIndex ];
+       }
+
+    if( needed < lowTotal || needed > highTotal )
+       {
+        return false;
+       }
+
+    if( xIndex == pruneTable->rowSize - 1 && pruneTable->allPositive )
+       {
+        prefix = &pruneTable->rowPrefix[ (size_t)xIndex * ( colSize + 1 ) ];
+
+        // segment from this cell rightward: prefix[ k ] - prefix[ y ]
+        if( entryDirection != MOVING_LEFT && hasPrefixValue( prefix, 
+                               yIndex + 1, colSize, prefix[ yIndex ] + needed ) )
+           {
+            return true;
+           }
+
+        // segment from this cell leftward: prefix[ y + 1 ] - prefix[ k ]
+        return entryDirection != MOVING_RIGHT && hasPrefixValue( prefix, 
+                                      0, yIndex, prefix[ yIndex + 1 ] - needed );
+       }
+
+    return true;
+   }
+
+/*
+Name: openTraceBuffer
+Process: opens trace file, empties buffer, and sets buffer as trace sink,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to trace buffer (TraceBufferType *),
+                           file name (const char *)
+Function Output/Parameters: pointer to trace buffer (TraceBufferType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/file: trace file opened
+Dependencies: fopen, accessTraceSink
+*/
+bool openTraceBuffer( TraceBufferType *traceBuffer, const char *fileName )
+   {
+    TraceSinkType bufferSink = { writeTraceToBuffer, NULL };
+
+    traceBuffer->used = 0;
+
+    traceBuffer->filePtr = fopen( fileName, "w" );
+
+    if( traceBuffer->filePtr == NULL )
+       {
+        return false;
+       }
+
+    bufferSink.context = traceBuffer;
+
+    accessTraceSink( SET_TRACE_SINK, bufferSink );
+
+    return true;
+   }
+
+/*
+Name: pushSearchFrame
+Process: adds frame to top of stack, doubling capacity when full,
+         returns true if successful, false if the stack cannot grow
+Function Input/Parameters: pointer to frame stack (SearchStackType *),
+                           cell placed (CellDataType),
+                           total including cell (int),
+                           first direction to try (int)
+Function Output/Parameters: pointer to frame stack (SearchStackType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: realloc
+*/
+bool pushSearchFrame( SearchStackType *searchStack, CellDataType current,
+                                            int runningTotal, int nextMove )
+   {
+    SearchFrameType *newFrames, *topFrame;
+
+    if( searchStack->size == searchStack->capacity )
+       {
+        newFrames = realloc( searchStack->frames, 
+                2 * (size_t)searchStack->capacity * sizeof( SearchFrameType ) );
+
+        if( newFrames == NULL )
+           {
+            return false;
+           }
+
+        searchStack->frames = newFrames;
+
+        searchStack->capacity *= 2;
+       }
+
+    topFrame = &searchStack->frames[ searchStack->size ];
+
+    topFrame->current = current;
+    topFrame->runningTotal = runningTotal;
+    topFrame->nextMove = nextMove;
+
+    searchStack->size++;
+
+    return true;
+   }
+
+/*
+Name: runSearch
+Process: runs the selected search engine on prepared search data
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           search engine (SearchModes)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/monitor: operation of search when verbose
+Dependencies: findSumHelper, findSumIterative, findSumParallel,
+              findSumReachable, findSumMemoized, findSumSegments,
+              findSumBitboard, findSumCompact, getSearchThreadCount
+*/
+bool runSearch( SearchContextType *searchData, SearchModes searchMode )
+   {
+    int startingXIndex = 0, startingYIndex = 0;
+    int startingTotal = 0, startingRecLevel = 0;
+
+    if( searchMode == ITERATIVE_SEARCH )
+       {
+        return findSumIterative( searchData );
+       }
+
+    if( searchMode == PARALLEL_SEARCH )
+       {
+        return findSumParallel( searchData, getSearchThreadCount() );
+       }
+
+    if( searchMode == REACHABILITY_SEARCH )
+       {
+        return findSumReachable( searchData );
+       }
+
+    if( searchMode == MEMOIZED_SEARCH )
+       {
+        return findSumMemoized( searchData );
+       }
+
+    if( searchMode == SEGMENT_SEARCH )
+       {
+        return findSumSegments( searchData );
+       }
+
+    if( searchMode == BITBOARD_SEARCH )
+       {
+        return findSumBitboard( searchData );
+       }
+
+    if( searchMode == COMPACT_SEARCH )
+       {
+        return findSumCompact( searchData );
+       }
+
+    return findSumHelper( searchData, startingTotal, startingXIndex, 
+                                         startingYIndex, startingRecLevel );
+   }
+
+/*
+Name: setArrayValue
+Process: stores value at given row and column,
+         indices are assumed to be in bounds
+Function Input/Parameters: row and column indices (int), value (int)
+Function Output/Parameters: pointer to array data (ArrayType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+void setArrayValue( ArrayType *dataArray, 
+                                    int rowIndex, int colIndex, int value )
+   {
+    dataArray->array[ (size_t)rowIndex * dataArray->colSize + colIndex ] 
+                                                                      = value;
+   }
+
+/*
+Name: visitSolution
+Process: path visitor for findAllSums, counts solution and passes its
+         path to the stream's handler if there is one,
+         returns handler result, or true to keep counting without one
+Function Input/Parameters: pointer to search data with solution stream
+                           in visit context (SearchContextType *),
+                           total of path (int),
+                           path result (ControlCodes)
+Function Output/Parameters: pointer to search data (SearchContextType *)
+Function Output/Returned: continue flag (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: solution handler
+*/
+bool visitSolution( SearchContextType *searchData, int runningTotal,
+                                                   ControlCodes pathResult )
+   {
+    SolutionStreamType *solutionStream = searchData->visitContext;
+
+    (void)runningTotal;
+    (void)pathResult;
+
+    solutionStream->solutionCount++;
+
+    if( solutionStream->handleSolution == NULL )
+       {
+        return true;
+       }
+
+    return solutionStream->handleSolution( solutionStream->context,
+              searchData->foundSet->setArray, searchData->foundSet->size );
+   }
+
+/*
+Name: writeSolutionToFile
+Process: solution handler that writes path as one line of cells,
+         returns true to keep searching unless the write failed
+Function Input/Parameters: output file (FILE * as void *),
+                           path cells (const CellDataType *),
+                           number of cells in path (int)
+Function Output/Parameters: none
+Function Output/Returned: continue flag (bool)
+Device Input/---: none
+Device Output/file: path written to file
+Dependencies: cellToString, fputs, fputc, ferror
+*/
+bool writeSolutionToFile( void *filePtr, const CellDataType *path, 
+                                                          int pathLength )
+   {
+    int index;
+    char tempStr[ STD_STR_LEN ];
+
+    for( index = 0; index < pathLength; index++ )
+       {
+        if( index > 0 )
+           {
+            fputc( COMMA, filePtr );
+           }
+
+        cellToString( tempStr, path[ index ] );
+
+        fputs( tempStr, filePtr );
+       }
+
+    fputc( NEWLINE_CHAR, filePtr );
+
+    return !ferror( filePtr );
+   }
+
+/*
+Name: writeTraceToBuffer
+Process: trace sink that collects text in trace buffer,
+         writing to the trace file only when the buffer fills
+Function Input/Parameters: trace buffer (void *, TraceBufferType),
+                           text (const char *), text length (int)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/---: none
+Device Output/file: full buffers written to trace file
+Dependencies: flushTraceBuffer, memcpy, fwrite
+*/
+void writeTraceToBuffer( void *context, const char *text, int length )
+   {
+    TraceBufferType *traceBuffer = (TraceBufferType *)context;
+
+    if( traceBuffer->used + length > TRACE_BUFFER_SIZE )
+       {
+        flushTraceBuffer( traceBuffer );
+       }
+
+    if( length > TRACE_BUFFER_SIZE )
+       {
+        fwrite( text, 1, length, traceBuffer->filePtr );
+       }
+
+    else
+       {
+        memcpy( traceBuffer->buffer + traceBuffer->used, text, length );
+
+        traceBuffer->used += length;
+       }
+   }
+
+/*
+Name: writeTraceToConsole
+Process: default trace sink, writes text to standard output
+Function Input/Parameters: unused context (void *),
+                           text (const char *), text length (int)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/---: none
+Device Output/monitor: text displayed
+Dependencies: fwrite
+*/
+void writeTraceToConsole( void *context, const char *text, int length )
+   {
+    (void)context;
+
+    fwrite( text, 1, length, stdout );
+   }
@@ -2,31 +2,327 @@
 #define RB_UTILITY_H
 
 // included headers
+#include <limits.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 #include "StandardConstants.h"
 #include "SetUtilitiesFour.h"
 
 // local constants
-typedef enum { REC_LEVEL_INDENT = 3, MAX_ROWS = 10, MAX_COLS = 10 } OperationalData;
+typedef enum { REC_LEVEL_INDENT = 3, SEARCH_MOVES = 3, 
+               FRAME_STACK_START = 64, TRACE_INDENT_CHUNK = 64,
+               TRACE_BUFFER_SIZE = 65536, 
+               CANCEL_CHECK_INTERVAL = 1024 } OperationalData;
 typedef enum { VALID_ITEM = 101, INVALID_ITEM = 102, 
                DUPLICATE_ITEM, OVER_SUM, 
-               OUT_OF_BOUNDS, TEST_LOCATION, NO_SOLUTION } ControlCodes;
+               OUT_OF_BOUNDS, TEST_LOCATION, NO_SOLUTION,
+               SOLUTION_FOUND, PRUNED_BRANCH } ControlCodes;
+typedef enum { RECURSIVE_SEARCH = 201, ITERATIVE_SEARCH, 
+               PARALLEL_SEARCH, REACHABILITY_SEARCH, 
+               MEMOIZED_SEARCH, SEGMENT_SEARCH, 
+               BITBOARD_SEARCH, COMPACT_SEARCH } SearchModes;
+typedef enum { GET_TRACE_SINK = 301, SET_TRACE_SINK } TraceControlCodes;
+typedef enum { FROM_ABOVE = 401, MOVING_RIGHT, MOVING_LEFT } EntryDirections;
 
-// data structure for array
+// search tracing switch, compile with -DRB_TRACE_ENABLED=0 to remove
+// all trace calls from the search; when enabled, non-verbose searches
+// skip displayStatus entirely rather than formatting unused text
+#ifndef RB_TRACE_ENABLED
+#define RB_TRACE_ENABLED 1
+#endif
+
+#if RB_TRACE_ENABLED
+#define TRACE_STATUS( recLevel, status, current, opSuccess, verbose )       \
+   do { if( verbose )                                                        \
+           displayStatus( recLevel, status, current, opSuccess, true );     \
+      } while( 0 )
+#else
+#define TRACE_STATUS( recLevel, status, current, opSuccess, verbose )       \
+   do { (void)( verbose ); } while( 0 )
+#endif
+
+// data structure for array,
+// heap allocated and stored row-major: value at row r, column c
+// is found at array[ r * colSize + c ]
 typedef struct ArrayStruct
    {
-    int array[ MAX_ROWS ][ MAX_COLS ];
+    int *array;
 
     int rowSize, colSize;    
    } ArrayType;
 
+// pruning bounds, row-major like ArrayType: lowest and highest total
+// of any path from a cell (including its value) to a stop in the bottom
+// row when it continues right or left through the cell's row,
+// plus row prefix sums with colSize + 1 entries per row
+typedef struct PruneTableStruct
+   {
+    int *minRight, *minLeft;
+
+    int *maxRight, *maxLeft;
+
+    long long *rowPrefix;
+
+    int rowSize, colSize;
+
+    bool allPositive;
+   } PruneTableType;
+
+struct SearchContextStruct;
+
+struct FailedStateTableStruct;
+
+struct CompactGridStruct;
+
+// path visitor for the iterative search, receives search data with the
+// path in its set, total, and SOLUTION_FOUND or VALID_ITEM at split depth;
+// returns true to remove the cell and keep searching, false to stop
+typedef bool (*PathVisitorType)( struct SearchContextStruct *searchData, 
+                                 int runningTotal, ControlCodes pathResult );
+
+// state shared by every level of one search
+typedef struct SearchContextStruct
+   {
+    const ArrayType *dataArray;
+
+    const PruneTableType *pruneTable;
+
+    // optional 16 bit copy of the grid for the compact search,
+    // built for each search when not given
+    const struct CompactGridStruct *compactGrid;
+
+    SetType *foundSet;
+
+    int sumRequest;
+
+    int iterationCount, prunedCount;
+
+    // deepest search level tested, the longest path tried
+    int peakDepth;
+
+    bool verbose;
+
+    // optional visitor and its data, split depth 0 visits solutions only
+    PathVisitorType visitPath;
+
+    void *visitContext;
+
+    int splitDepth;
+
+    // optional cancellation, search stops once *stopIndex < taskIndex
+    const atomic_int *stopIndex;
+
+    int taskIndex;
+
+    // exhausted top row start moves on to the next top row cell
+    bool restartTopRow;
+
+    // known failed states of this search, skipped instead of searched
+    // past, set only by findSumMemoized, with lookups and hits of the
+    // last memoized search
+    struct FailedStateTableStruct *failedStates;
+
+    long long memoLookupCount, memoHitCount;
+   } SearchContextType;
+
+// one level of the iterative search: cell placed, total including it,
+// and next direction to try (0 right, 1 down, 2 left, SEARCH_MOVES done)
+typedef struct SearchFrameStruct
+   {
+    CellDataType current;
+
+    int runningTotal;
+
+    int nextMove;
+   } SearchFrameType;
+
+// heap allocated frame stack for the iterative search
+typedef struct SearchStackStruct
+   {
+    SearchFrameType *frames;
+
+    int size, capacity;
+   } SearchStackType;
+
+// receives each path found by findAllSums, with its context,
+// returns true to keep searching, false to stop
+typedef bool (*SolutionHandlerType)( void *context, 
+                             const CellDataType *path, int pathLength );
+
+// destination and counts for findAllSums, a NULL handler counts only
+typedef struct SolutionStreamStruct
+   {
+    SolutionHandlerType handleSolution;
+
+    void *context;
+
+    long long solutionCount;
+
+    int iterationCount;
+   } SolutionStreamType;
+
+// trace output function, receives context and text with its length
+typedef void (*TraceWriterType)( void *context, const char *text, int length );
+
+// destination for trace output
+typedef struct TraceSinkStruct
+   {
+    TraceWriterType writeTrace;
+
+    void *context;
+   } TraceSinkType;
+
+// trace sink context that collects trace text and writes it in large blocks
+typedef struct TraceBufferStruct
+   {
+    FILE *filePtr;
+
+    int used;
+
+    char buffer[ TRACE_BUFFER_SIZE ];
+   } TraceBufferType;
+
 // prototypes
 
+/*
+Name: accessTraceSink
+Process: allows setting or accessing the sink that receives trace output;
+         note: sink is maintained (static) value initialized to console
+Function Input/Parameters: control code (TraceControlCodes), 
+                           new sink (TraceSinkType),
+                           ignored if not setting sink
+Function Output/Parameters: none
+Function Output/Returned: current sink (TraceSinkType)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+TraceSinkType accessTraceSink( TraceControlCodes ctrlCode, 
+                                                     TraceSinkType newSink );
+
+/*
+Name: checkLocation
+Process: counts and reports attempt at location, keeping the deepest
+         recursion level tried, then tests it in order
+         for out of bounds, over sum, and already in set,
+         if valid, adds cell to set and updates running total,
+         a cell reaching the sum outside the bottom row is removed again,
+         with a prune table, a valid cell from which the sum cannot be
+         reached in the bottom row is counted and reported as pruned,
+         returns SOLUTION_FOUND if sum reached in bottom row,
+         VALID_ITEM if search continues from this cell,
+         PRUNED_BRANCH if cell is placed but has no useful continuation,
+         otherwise the reported failure code
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           pointer to working total (int *),
+                           x and y indices (int),
+                           recursion level for reporting (int)
+Function Output/Parameters: pointer to search data (SearchContextType *),
+                            pointer to working total (int *),
+                            pointer to tested cell (CellDataType *)
+Function Output/Returned: result of test (ControlCodes)
+Device Input/---: none
+Device Output/monitor: status of cell attempt
+Dependencies: setCellData, displayStatus, isInBounds, getArrayValue,
+              addItem, deleteItem, isSumReachable
+*/
+ControlCodes checkLocation( SearchContextType *searchData, int *runningTotal,
+                            int xIndex, int yIndex, int recLevel,
+                            CellDataType *current );
+
+/*
+Name: clearArray
+Process: releases heap memory held by array, resets sizes to zero,
+         safe to call on an array that was never allocated
+Function Input/Parameters: pointer to array data (ArrayType *)
+Function Output/Parameters: pointer to array data (ArrayType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearArray( ArrayType *dataArray );
+
+/*
+Name: clearPruneTable
+Process: releases heap memory held by prune table, resets sizes to zero,
+         safe to call on a table that was never allocated
+Function Input/Parameters: pointer to prune table (PruneTableType *)
+Function Output/Parameters: pointer to prune table (PruneTableType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearPruneTable( PruneTableType *pruneTable );
+
+/*
+Name: clearSearchStack
+Process: releases heap memory held by frame stack, resets sizes to zero
+Function Input/Parameters: pointer to frame stack (SearchStackType *)
+Function Output/Parameters: pointer to frame stack (SearchStackType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearSearchStack( SearchStackType *searchStack );
+
+/*
+Name: closeTraceBuffer
+Process: flushes remaining buffered trace, closes trace file,
+         restores console trace sink,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to trace buffer (TraceBufferType *)
+Function Output/Parameters: pointer to trace buffer (TraceBufferType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/file: remaining trace written, file closed
+Dependencies: flushTraceBuffer, fclose, accessTraceSink
+*/
+bool closeTraceBuffer( TraceBufferType *traceBuffer );
+
+/*
+Name: continueSearch
+Process: iterative backtracking core, resolves a pending location result
+         and then tries right, down, left from the top frame until a
+         solution is found or the stack falls back to the base size;
+         an exhausted top row start restarts from the next top row cell
+         when the search data allows it, a visitor in the search data
+         receives each solution and each path reaching the split depth
+         and removes it to keep searching by returning true,
+         without a visitor a failed state table in the search data
+         skips known failed cells and keeps each exhausted frame,
+         a cancelled search stops early and returns false
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           pointer to frame stack (SearchStackType *),
+                           stack size to stop at (int),
+                           pending location result (ControlCodes),
+                           pending cell (CellDataType),
+                           total including pending cell (int)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *),
+                            pointer to frame stack (SearchStackType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/monitor: operation of backtracking
+Dependencies: checkLocation, displayStatus, deleteItem, pushSearchFrame,
+              atomic_load_explicit, getEntryDirection, isFailedState,
+              storeFailedState
+*/
+bool continueSearch( SearchContextType *searchData, 
+                     SearchStackType *searchStack, int baseSize, 
+                     ControlCodes locationResult, CellDataType current, 
+                     int runningTotal );
+
 /*
 Name: displayStatus
 Process: displays appropriately indented report of next attempt
          to place value, with ControlCodes as follows:
          VALID_ITEM, INVALID_ITEM, DUPLICATE_ITEM, OVER_SUM,
-         OUT_OF_BOUNDS, TEST_LOCATION, and NO_SOLUTION
+         OUT_OF_BOUNDS, TEST_LOCATION, NO_SOLUTION, and PRUNED_BRANCH
 Function Input/Parameters: recursion level for indentation (int),
                            status string reporting action (const char *),
                            cell data being tested (CellDataType),
@@ -36,7 +332,7 @@ Function Output/Parameters: none
 Function Output/Returned: none
 Device Input/---: none
 Device Output/monitor: status of cell attempt
-Dependencies: printf, cellToString
+Dependencies: sprintf, cellToString, accessTraceSink
 */
 void displayStatus( int recLevel, const char *status, CellDataType current,
                                       ControlCodes opSuccess, bool verboseFlag );
@@ -44,14 +340,62 @@ void displayStatus( int recLevel, const char *status, CellDataType current,
 /*
 Name: dumpArray
 Process: simple 2D array dump of array data
-Function Input/Parameters: title (const char *)array data (ArrayType)
+Function Input/Parameters: title (const char *),
+                           pointer to array data (const ArrayType *)
 Function Output/Parameters: none
 Function Output/Returned: none
 Device Input/---: none
 Device Output/monitor: display of 2D array
-Dependencies: printf
+Dependencies: printf, getArrayValue
+*/
+void dumpArray( const char *title, const ArrayType *dispArray );
+
+/*
+Name: findAllSums
+Process: searches every top row start for every path that adds up 
+         to the requested sum, ending at the first bottom row cell 
+         that reaches it as findSum does, and streams each one to the 
+         solution handler as it is found without storing it;
+         a NULL handler only counts solutions,
+         unlike findSum a start cell that fails does not end the search,
+         returns true if the search completed, false if the handler 
+         stopped it or memory could not be allocated
+Function Input/Parameters: pointer to data array (const ArrayType *),
+                           pointer to prune table (const PruneTableType *),
+                           NULL searches without pruning,
+                           value to sum up to (int),
+                           pointer to solution stream with handler and 
+                           its context (SolutionStreamType *)
+Function Output/Parameters: pointer to solution stream with solution
+                            and iteration counts (SolutionStreamType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: initializeGridSet, initializeSearchStack, 
+              initializeSearchContext, checkLocation, continueSearch,
+              visitSolution, deleteItem, clearSearchStack, clearSet
 */
-void dumpArray( const char *title, const ArrayType dispArray );
+bool findAllSums( const ArrayType *dataArray, 
+                  const PruneTableType *pruneTable, int sumRequest,
+                  SolutionStreamType *solutionStream );
+
+/*
+Name: findBoundsBelow
+Process: finds lowest and highest total that can follow a cell
+         by moving down from it, in the bottom row the path may stop
+         so the bounds are zero, otherwise the bounds of entering
+         the cell below in either direction
+Function Input/Parameters: pointer to prune table (const PruneTableType *),
+                           row and column index (int), bottom row flag (bool)
+Function Output/Parameters: lowest and highest total (long long *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+void findBoundsBelow( const PruneTableType *pruneTable, 
+                      int rowIndex, int colIndex, bool bottomRow,
+                      long long *lowBelow, long long *highBelow );
 
 /*
 Name: findSum
@@ -82,55 +426,340 @@ Process: Calls helper to find contiguous values
          - The method must be able to handle the condition
            that the value in the upper left corner does not support the solution 
 
-Function Input/Parameters: data array (ArrayType),
+Function Input/Parameters: pointer to data array (const ArrayType *),
+                           pointer to prune table (const PruneTableType *),
+                           NULL searches without pruning,
                            value to sum up to (int), 
+                           search engine (SearchModes: RECURSIVE_SEARCH,
+                           ITERATIVE_SEARCH, PARALLEL_SEARCH which
+                           finds the same solution without tracing,
+                           REACHABILITY_SEARCH which finds any solution
+                           without backtracking or tracing, trying
+                           every top row start where the others stop
+                           at the first start cell that fails,
+                           MEMOIZED_SEARCH which finds the same solution
+                           skipping known failed states, or
+                           SEGMENT_SEARCH which finds the same solution
+                           a row segment at a time without tracing),
+                           ITERATIVE_SEARCH of a grid with at most
+                           BITBOARD_CELLS cells runs as BITBOARD_SEARCH,
+                           the same search with the set held in bits,
                            verbose flag controls description(bool)
 Function Output/Parameters: none
 Function Output/Returned: none
 Device Input/---: none
 Device Output/monitor: display of process
-Dependencies: initializeSet, printf, findSumHelper, displaySet
+Dependencies: initializeGridSet, initializeSearchContext, printf, 
+              isBitboardGrid, runSearch, displaySet, clearSet
 */
-void findSum( const ArrayType dataArray, int sumRequest, bool verbose );
- 
+void findSum( const ArrayType *dataArray, const PruneTableType *pruneTable,
+                     int sumRequest, SearchModes searchMode, bool verbose );
+
 /*
 Name: findSumHelper
 Process: specifications in calling function
-Function Input/Parameters: sum value result requested (int),
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           holding sum requested, resulting set, data array,
+                           prune table, counts, and verbose flag,
                            starting and then working total (int),
                            starting x and y indices (int),
-                           pointer toresulting set (SetType *), 
-                           data array (const ArrayType)
-                           starting and then working recursion level (int),
-                           pointer to iteration count (int *)
-                           verbose flag (bool)
-Function Output/Parameters: pointer to iteration count to be returned (int *)
+                           starting and then working recursion level (int)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts to be returned (SearchContextType *)
 Function Output/Returned: result of given attempt (bool)
 Device Input/---: none
 Device Output/monitor: operation of recursive backtracking
-Dependencies: setCellData, displayStatus, isInBounds, isInSet, 
-              addItem, findSumHelper (recursive),
+Dependencies: checkLocation, displayStatus, deleteItem, 
+              findSumHelper (recursive),
               other functions in this file are allowed,
               Note: displayStatus is used exclusively, 
               no other printing functions are allowed
 */
-bool findSumHelper( int sumRequest, int runningTotal,
-                    int xIndex, int yIndex, 
-                    SetType *foundSet, const ArrayType dataArray,
-                    int recLevel, int *iterationCount, 
-                    bool verbose );
- 
+bool findSumHelper( SearchContextType *searchData, int runningTotal,
+                    int xIndex, int yIndex, int recLevel );
+
+/*
+Name: findSumIterative
+Process: same search as findSumHelper with the same right, down, left
+         order, report and iteration count, but keeps the path in a
+         heap allocated frame stack instead of recursion so path length
+         is not limited by the native stack,
+         returns false if no solution or the frame stack cannot grow
+Function Input/Parameters: pointer to search data (SearchContextType *)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/monitor: operation of backtracking
+Dependencies: checkLocation, continueSearch, initializeSearchStack, 
+              clearSearchStack
+*/
+bool findSumIterative( SearchContextType *searchData );
+
+/*
+Name: flushTraceBuffer
+Process: writes buffered trace text to trace file, empties buffer,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to trace buffer (TraceBufferType *)
+Function Output/Parameters: pointer to trace buffer (TraceBufferType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/file: buffered trace written
+Dependencies: fwrite
+*/
+bool flushTraceBuffer( TraceBufferType *traceBuffer );
+
+/*
+Name: getArrayValue
+Process: returns value stored at given row and column,
+         indices are assumed to be in bounds
+Function Input/Parameters: pointer to array data (const ArrayType *),
+                           row and column indices (int)
+Function Output/Parameters: none
+Function Output/Returned: value at location (int)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+int getArrayValue( const ArrayType *dataArray, int rowIndex, int colIndex );
+
+/*
+Name: hasPrefixValue
+Process: binary search of strictly increasing prefix sums 
+         between low and high indices, inclusive
+Function Input/Parameters: prefix sums (const long long *),
+                           low and high indices (int), search value (long long)
+Function Output/Parameters: none
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+bool hasPrefixValue( const long long *prefix, 
+                             int lowIndex, int highIndex, long long searchVal );
+
+/*
+Name: initializeArray
+Process: allocates contiguous row-major storage for given dimensions,
+         returns true if successful, false for invalid sizes
+         or failed allocation (array is left empty)
+Function Input/Parameters: number of rows and columns (int)
+Function Output/Parameters: pointer to array data (ArrayType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: malloc
+*/
+bool initializeArray( ArrayType *dataArray, int rowSize, int colSize );
+
+/*
+Name: initializePruneTable
+Process: preprocessing pass over data array for pruning,
+         row prefix sums, then from the bottom row up, the lowest and
+         highest total of any path from each cell (including its value)
+         to a stop in the bottom row that continues right or left through
+         the cell's row before moving down, totals saturate at int limits,
+         returns true if successful, false for failed allocation
+         (table is left empty)
+Function Input/Parameters: pointer to data array (const ArrayType *)
+Function Output/Parameters: pointer to prune table (PruneTableType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: malloc, getArrayValue, clearPruneTable
+*/
+bool initializePruneTable( PruneTableType *pruneTable, 
+                                                const ArrayType *dataArray );
+
+/*
+Name: initializeSearchContext
+Process: sets search data for a plain first solution search from the top
+         left cell, with counts zeroed and no compact grid,
+         visitor, or cancellation
+Function Input/Parameters: pointer to data array (const ArrayType *),
+                           pointer to prune table or NULL 
+                                                  (const PruneTableType *),
+                           pointer to working set (SetType *),
+                           sum requested (int), verbose flag (bool)
+Function Output/Parameters: pointer to search data (SearchContextType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+void initializeSearchContext( SearchContextType *searchData, 
+                        const ArrayType *dataArray, 
+                        const PruneTableType *pruneTable, SetType *foundSet,
+                        int sumRequest, bool verbose );
+
+/*
+Name: initializeSearchStack
+Process: allocates frame stack at its starting capacity, 
+         returns true if successful, false otherwise
+Function Input/Parameters: none
+Function Output/Parameters: pointer to frame stack (SearchStackType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: malloc
+*/
+bool initializeSearchStack( SearchStackType *searchStack );
+
 /*
 Name: isInBounds
-Process: tests x and y locations for in array bounds
+Process: tests x (row) and y (column) locations for in array bounds
 Function Input/Parameters: x & y locations (int),
-                           data array (ArrayType)
+                           pointer to data array (const ArrayType *)
 Function Output/Parameters: none
 Function Output/Returned: result of test (bool)
 Device Input/---: none
 Device Output/---: none
 Dependencies: none
 */
-bool isInBounds( ArrayType dataArray, int xLocTest, int yLocTest );
+bool isInBounds( const ArrayType *dataArray, int xLocTest, int yLocTest );
+
+/*
+Name: isSumReachable
+Process: tests whether a path placed at a cell can still end in the
+         bottom row at the requested sum, using the bounds for the
+         directions still open in the cell's row (both from above,
+         otherwise only the direction of travel), in the bottom row
+         of an all positive array the remaining segment sums are
+         matched exactly with a binary search of the row prefix sums
+Function Input/Parameters: pointer to prune table (const PruneTableType *),
+                           x and y indices (int), 
+                           direction cell was entered (EntryDirections),
+                           total before this cell (int), sum requested (int)
+Function Output/Parameters: none
+Function Output/Returned: result of test (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: hasPrefixValue
+*/
+bool isSumReachable( const PruneTableType *pruneTable, 
+                     int xIndex, int yIndex, EntryDirections entryDirection,
+                     int totalBefore, int sumRequest );
+
+/*
+Name: openTraceBuffer
+Process: opens trace file, empties buffer, and sets buffer as trace sink,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to trace buffer (TraceBufferType *),
+                           file name (const char *)
+Function Output/Parameters: pointer to trace buffer (TraceBufferType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/file: trace file opened
+Dependencies: fopen, accessTraceSink
+*/
+bool openTraceBuffer( TraceBufferType *traceBuffer, const char *fileName );
+
+/*
+Name: pushSearchFrame
+Process: adds frame to top of stack, doubling capacity when full,
+         returns true if successful, false if the stack cannot grow
+Function Input/Parameters: pointer to frame stack (SearchStackType *),
+                           cell placed (CellDataType),
+                           total including cell (int),
+                           first direction to try (int)
+Function Output/Parameters: pointer to frame stack (SearchStackType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: realloc
+*/
+bool pushSearchFrame( SearchStackType *searchStack, CellDataType current,
+                                            int runningTotal, int nextMove );
+
+/*
+Name: runSearch
+Process: runs the selected search engine on prepared search data
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           search engine (SearchModes)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/monitor: operation of search when verbose
+Dependencies: findSumHelper, findSumIterative, findSumParallel,
+              findSumReachable, findSumMemoized, findSumSegments,
+              findSumBitboard, findSumCompact, getSearchThreadCount
+*/
+bool runSearch( SearchContextType *searchData, SearchModes searchMode );
+
+/*
+Name: setArrayValue
+Process: stores value at given row and column,
+         indices are assumed to be in bounds
+Function Input/Parameters: row and column indices (int), value (int)
+Function Output/Parameters: pointer to array data (ArrayType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+void setArrayValue( ArrayType *dataArray, 
+                                    int rowIndex, int colIndex, int value );
+
+/*
+Name: visitSolution
+Process: path visitor for findAllSums, counts solution and passes its
+         path to the stream's handler if there is one,
+         returns handler result, or true to keep counting without one
+Function Input/Parameters: pointer to search data with solution stream
+                           in visit context (SearchContextType *),
+                           total of path (int),
+                           path result (ControlCodes)
+Function Output/Parameters: pointer to search data (SearchContextType *)
+Function Output/Returned: continue flag (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: solution handler
+*/
+bool visitSolution( SearchContextType *searchData, int runningTotal,
+                                                   ControlCodes pathResult );
+
+/*
+Name: writeSolutionToFile
+Process: solution handler that writes path as one line of cells,
+         returns true to keep searching unless the write failed
+Function Input/Parameters: output file (FILE * as void *),
+                           path cells (const CellDataType *),
+                           number of cells in path (int)
+Function Output/Parameters: none
+Function Output/Returned: continue flag (bool)
+Device Input/---: none
+Device Output/file: path written to file
+Dependencies: cellToString, fputs, fputc, ferror
+*/
+bool writeSolutionToFile( void *filePtr, const CellDataType *path, 
+                                                          int pathLength );
+
+/*
+Name: writeTraceToBuffer
+Process: trace sink that collects text in trace buffer,
+         writing to the trace file only when the buffer fills
+Function Input/Parameters: trace buffer (void *, TraceBufferType),
+                           text (const char *), text length (int)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/---: none
+Device Output/file: full buffers written to trace file
+Dependencies: flushTraceBuffer, memcpy, fwrite
+*/
+void writeTraceToBuffer( void *context, const char *text, int length );
+
+/*
+Name: writeTraceToConsole
+Process: default trace sink, writes text to standard output
+Function Input/Parameters: unused context (void *),
+                           text (const char *), text length (int)
+Function Output/Parameters: none
+Function Output/Returned: none
+Device Input/---: none
+Device Output/monitor: text displayed
+Dependencies: fwrite
+*/
+void writeTraceToConsole( void *context, const char *text, int length );
 
 #endif  // RB_UTILITY_H
@@ -0,0 +1,518 @@
+// included headers
+#include "Segment_Search_Utility.h"
+
+/*
+Name: findLastBelow
+Process: binary search of strictly increasing prefix sums between
+         low and high indices, inclusive, for the last one below limit,
+         returns its index, or one less than low if there is none
+Function Input/Parameters: prefix sums (const long long *),
+                           low and high indices (int), limit (long long)
+Function Output/Parameters: none
+Function Output/Returned: index found (int)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+static int findLastBelow( const long long *prefix,
+                                  int lowIndex, int highIndex, long long limit )
+   {
+    int midIndex;
+
+    while( lowIndex <= highIndex )
+       {
+        midIndex = lowIndex + ( highIndex - lowIndex ) / 2;
+
+        if( prefix[ midIndex ] < limit )
+           {
+            lowIndex = midIndex + 1;
+           }
+
+        else
+           {
+            highIndex = midIndex - 1;
+           }
+       }
+
+    return highIndex;
+   }
+
+/*
+Name: findPrefixIndex
+Process: binary search of strictly increasing prefix sums between
+         low and high indices, inclusive,
+         returns index of search value, or -1 if it is not found
+Function Input/Parameters: prefix sums (const long long *),
+                           low and high indices (int), search value (long long)
+Function Output/Parameters: none
+Function Output/Returned: index found (int)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+static int findPrefixIndex( const long long *prefix,
+                             int lowIndex, int highIndex, long long searchVal )
+   {
+    int midIndex;
+
+    while( lowIndex <= highIndex )
+       {
+        midIndex = lowIndex + ( highIndex - lowIndex ) / 2;
+
+        if( prefix[ midIndex ] == searchVal )
+           {
+            return midIndex;
+           }
+
+        if( prefix[ midIndex ] < searchVal )
+           {
+            lowIndex = midIndex + 1;
+           }
+
+        else
+           {
+            highIndex = midIndex - 1;
+           }
+       }
+
+    return -1;
+   }
+
+/*
+Name: addSegmentPath
+Process: adds the cells of every row segment on the frame stack to
+         the set, top to bottom and in the order each row was crossed,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to data array (const ArrayType *),
+                           segment frames (const SegmentFrameType []),
+                           number of frames (int)
+Function Output/Parameters: pointer to resulting set (SetType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: getArrayValue, setCellData, addItem
+*/
+bool addSegmentPath( const ArrayType *dataArray, 
+                     const SegmentFrameType frames[], int frameCount,
+                                                        SetType *foundSet )
+   {
+    int rowIndex, colIndex, step;
+    CellDataType current;
+
+    for( rowIndex = 0; rowIndex < frameCount; rowIndex++ )
+       {
+        step = frames[ rowIndex ].pathEnd < frames[ rowIndex ].entryColumn
+                                                                     ? -1 : 1;
+
+        colIndex = frames[ rowIndex ].entryColumn - step;
+
+        do
+           {
+            colIndex += step;
+
+            setCellData( &current,
+                   getArrayValue( dataArray, rowIndex, colIndex ),
+                                                     rowIndex, colIndex );
+
+            if( !addItem( foundSet, current ) )
+               {
+                return false;
+               }
+           }
+        while( colIndex != frames[ rowIndex ].pathEnd );
+       }
+
+    return true;
+   }
+
+/*
+Name: clearSegmentTable
+Process: releases heap memory held by segment table, resets sizes to
+         zero, safe to call on a table that was never allocated
+Function Input/Parameters: pointer to segment table (SegmentTableType *)
+Function Output/Parameters: pointer to segment table (SegmentTableType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearSegmentTable( SegmentTableType *segmentTable )
+   {
+    free( segmentTable->rowPrefix );
+
+    segmentTable->rowPrefix = NULL;
+    segmentTable->rowSize = segmentTable->colSize = 0;
+   }
+
+/*
+Name: enterSegmentRow
+Process: counts and tests a row entered from above at a column,
+         with the same over sum, early sum, and prune rules as
+         checkLocation; in the bottom row looks for the first segment
+         reaching the sum, right then left as findSum tries them,
+         otherwise sets the frame's farthest right end, both found by
+         binary search of the prefix sums in an all positive array,
+         returns SOLUTION_FOUND with the frame's path end set,
+         VALID_ITEM if the row can be searched past, or in the bottom
+         row with no ends left to try, otherwise the failure code
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           pointer to segment table
+                                                (const SegmentTableType *),
+                           row index (int),
+                           pointer to frame with entry column, total
+                           before the row and path length set
+                                                (SegmentFrameType *)
+Function Output/Parameters: pointer to search data with counts
+                                                (SearchContextType *),
+                            pointer to frame (SegmentFrameType *)
+Function Output/Returned: result of test (ControlCodes)
+Device Input/---: none
+Device Output/---: none
+Dependencies: findPrefixIndex, findLastBelow, isSumReachable
+*/
+ControlCodes enterSegmentRow( SearchContextType *searchData,
+                              const SegmentTableType *segmentTable,
+                              int rowIndex, SegmentFrameType *frame )
+   {
+    int colSize = segmentTable->colSize, entry = frame->entryColumn;
+    int endIndex;
+    const long long *prefix
+                 = &segmentTable->rowPrefix[ (size_t)rowIndex * ( colSize + 1 ) ];
+    long long sumRequest = searchData->sumRequest, total;
+    long long needed = sumRequest - frame->totalBefore;
+    bool bottomRow = rowIndex == segmentTable->rowSize - 1;
+
+    searchData->iterationCount++;
+
+    if( frame->pathLength + 1 > searchData->peakDepth )
+       {
+        searchData->peakDepth = frame->pathLength + 1;
+       }
+
+    frame->pathEnd = entry;
+
+    total = prefix[ entry + 1 ] - prefix[ entry ];
+
+    if( total > needed )
+       {
+        return OVER_SUM;
+       }
+
+    if( total == needed )
+       {
+        return bottomRow ? SOLUTION_FOUND : NO_SOLUTION;
+       }
+
+    if( searchData->pruneTable != NULL
+          && !isSumReachable( searchData->pruneTable, rowIndex, entry,
+                    FROM_ABOVE, frame->totalBefore, searchData->sumRequest ) )
+       {
+        searchData->prunedCount++;
+
+        return PRUNED_BRANCH;
+       }
+
+    frame->rightEnd = entry;
+    frame->nextEnd = entry;
+
+    if( bottomRow )
+       {
+        frame->nextEnd = -1;
+
+        if( segmentTable->allPositive )
+           {
+            // segment rightward: prefix[ k ] - prefix[ entry ]
+            endIndex = findPrefixIndex( prefix, entry + 2, colSize,
+                                                   prefix[ entry ] + needed );
+
+            if( endIndex >= 0 )
+               {
+                frame->pathEnd = endIndex - 1;
+
+                return SOLUTION_FOUND;
+               }
+
+            // segment leftward: prefix[ entry + 1 ] - prefix[ k ]
+            endIndex = findPrefixIndex( prefix, 0, entry - 1,
+                                               prefix[ entry + 1 ] - needed );
+
+            if( endIndex >= 0 )
+               {
+                frame->pathEnd = endIndex;
+
+                return SOLUTION_FOUND;
+               }
+
+            return VALID_ITEM;
+           }
+
+        // each direction stops at the first cell over the sum
+        for( endIndex = entry + 1; endIndex < colSize
+                && ( total = prefix[ endIndex + 1 ] - prefix[ entry ] )
+                                                     <= needed; endIndex++ )
+           {
+            if( total == needed )
+               {
+                frame->pathEnd = endIndex;
+
+                return SOLUTION_FOUND;
+               }
+           }
+
+        for( endIndex = entry - 1; endIndex >= 0
+                && ( total = prefix[ entry + 1 ] - prefix[ endIndex ] )
+                                                     <= needed; endIndex-- )
+           {
+            if( total == needed )
+               {
+                frame->pathEnd = endIndex;
+
+                return SOLUTION_FOUND;
+               }
+           }
+
+        return VALID_ITEM;
+       }
+
+    // right ends stop before the first cell reaching the sum
+    if( segmentTable->allPositive )
+       {
+        frame->rightEnd = findLastBelow( prefix, entry + 1, colSize,
+                                                 prefix[ entry ] + needed ) - 1;
+       }
+
+    else
+       {
+        while( frame->rightEnd + 1 < colSize
+                 && prefix[ frame->rightEnd + 2 ] - prefix[ entry ] < needed )
+           {
+            frame->rightEnd++;
+           }
+       }
+
+    frame->nextEnd = frame->rightEnd;
+
+    if( frame->pathLength + frame->rightEnd - entry + 1
+                                                   > searchData->peakDepth )
+       {
+        searchData->peakDepth = frame->pathLength + frame->rightEnd - entry + 1;
+       }
+
+    return VALID_ITEM;
+   }
+
+/*
+Name: findSumSegments
+Process: same search and first solution as findSumIterative, but each
+         step chooses a whole row segment, the column it leaves the row
+         from, with its total from the prefix sums, rather than one cell;
+         right ends are tried farthest first, then left ends nearest
+         first, the order the cell search moves down from them,
+         keeps one frame per row and adds the full path to the set
+         only once it is found, iteration count is increased once per
+         row entered and once per left end tested, search is not traced,
+         the prefix sums of a prune table in the search data are used
+         when there is one, otherwise a table is built for this search,
+         falls back to findSumIterative if the table cannot be built
+Function Input/Parameters: pointer to search data (SearchContextType *)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: initializeSegmentTable, malloc, enterSegmentRow,
+              addSegmentPath, clearSegmentTable, free, findSumIterative
+*/
+bool findSumSegments( SearchContextType *searchData )
+   {
+    const ArrayType *dataArray = searchData->dataArray;
+    const PruneTableType *pruneTable = searchData->pruneTable;
+    int colSize = dataArray->colSize, frameCount = 0;
+    int startColumn, endColumn, entry;
+    long long total;
+    const long long *prefix;
+    SegmentTableType segmentTable;
+    SegmentFrameType *frames, *topFrame, *nextFrame;
+    ControlCodes rowResult;
+    bool found = false;
+
+    if( pruneTable != NULL )
+       {
+        segmentTable.rowPrefix = pruneTable->rowPrefix;
+        segmentTable.rowSize = pruneTable->rowSize;
+        segmentTable.colSize = pruneTable->colSize;
+        segmentTable.allPositive = pruneTable->allPositive;
+       }
+
+    else if( !initializeSegmentTable( &segmentTable, dataArray ) )
+       {
+        return findSumIterative( searchData );
+       }
+
+    frames = malloc( dataArray->rowSize * sizeof( SegmentFrameType ) );
+
+    if( frames == NULL )
+       {
+        if( pruneTable == NULL )
+           {
+            clearSegmentTable( &segmentTable );
+           }
+
+        return findSumIterative( searchData );
+       }
+
+    // each top row start in turn, as the cell search restarts
+    for( startColumn = 0; !found && startColumn < colSize; startColumn++ )
+       {
+        frames[ 0 ].entryColumn = startColumn;
+        frames[ 0 ].totalBefore = 0;
+        frames[ 0 ].pathLength = 0;
+
+        rowResult = enterSegmentRow( searchData, &segmentTable,
+                                                            0, &frames[ 0 ] );
+
+        // a start cell failing its test ends the search, as in findSum
+        if( rowResult != VALID_ITEM && rowResult != PRUNED_BRANCH
+                                     && rowResult != SOLUTION_FOUND )
+           {
+            break;
+           }
+
+        found = rowResult == SOLUTION_FOUND;
+
+        frameCount = rowResult == PRUNED_BRANCH ? 0 : 1;
+
+        while( !found && frameCount > 0 )
+           {
+            topFrame = &frames[ frameCount - 1 ];
+            entry = topFrame->entryColumn;
+            endColumn = topFrame->nextEnd;
+
+            prefix = &segmentTable.rowPrefix[
+                              (size_t)( frameCount - 1 ) * ( colSize + 1 ) ];
+
+            // right ends back to the entry column, all below the sum
+            if( endColumn >= entry )
+               {
+                total = prefix[ endColumn + 1 ] - prefix[ entry ];
+
+                topFrame->nextEnd = endColumn - 1;
+               }
+
+            // then left ends, until one reaches the sum
+            else if( endColumn >= 0 )
+               {
+                searchData->iterationCount++;
+
+                total = prefix[ entry + 1 ] - prefix[ endColumn ];
+
+                if( topFrame->totalBefore + total >= searchData->sumRequest )
+                   {
+                    endColumn = -1;
+                   }
+
+                topFrame->nextEnd = endColumn - 1;
+               }
+
+            // row exhausted, backtrack
+            if( endColumn < 0 )
+               {
+                frameCount--;
+
+                continue;
+               }
+
+            topFrame->pathEnd = endColumn;
+
+            nextFrame = &frames[ frameCount ];
+
+            nextFrame->entryColumn = endColumn;
+            nextFrame->totalBefore = (int)( topFrame->totalBefore + total );
+            nextFrame->pathLength = topFrame->pathLength
+                     + ( endColumn < entry ? entry - endColumn
+                                               : endColumn - entry ) + 1;
+
+            rowResult = enterSegmentRow( searchData, &segmentTable,
+                                                      frameCount, nextFrame );
+
+            if( rowResult == VALID_ITEM || rowResult == SOLUTION_FOUND )
+               {
+                frameCount++;
+
+                found = rowResult == SOLUTION_FOUND;
+               }
+           }
+
+        if( !searchData->restartTopRow )
+           {
+            break;
+           }
+       }
+
+    if( found )
+       {
+        found = addSegmentPath( dataArray, frames, frameCount,
+                                                     searchData->foundSet );
+       }
+
+    free( frames );
+
+    if( pruneTable == NULL )
+       {
+        clearSegmentTable( &segmentTable );
+       }
+
+    return found;
+   }
+
+/*
+Name: initializeSegmentTable
+Process: allocates and fills the row prefix sums of the data array,
+         noting whether every value is positive,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to data array (const ArrayType *)
+Function Output/Parameters: pointer to segment table (SegmentTableType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: malloc, getArrayValue
+*/
+bool initializeSegmentTable( SegmentTableType *segmentTable,
+                                                const ArrayType *dataArray )
+   {
+    int rowIndex, colIndex, value, colSize = dataArray->colSize;
+    long long *prefix;
+
+    segmentTable->rowSize = dataArray->rowSize;
+    segmentTable->colSize = colSize;
+    segmentTable->allPositive = true;
+
+    segmentTable->rowPrefix = malloc(
+        (size_t)dataArray->rowSize * ( colSize + 1 ) * sizeof( long long ) );
+
+    if( segmentTable->rowPrefix == NULL )
+       {
+        return false;
+       }
+
+    for( rowIndex = 0; rowIndex < dataArray->rowSize; rowIndex++ )
+       {
+        prefix = &segmentTable->rowPrefix[ (size_t)rowIndex * ( colSize + 1 ) ];
+
+        prefix[ 0 ] = 0;
+
+        for( colIndex = 0; colIndex < colSize; colIndex++ )
+           {
+            value = getArrayValue( dataArray, rowIndex, colIndex );
+
+            if( value <= 0 )
+               {
+                segmentTable->allPositive = false;
+               }
+
+            prefix[ colIndex + 1 ] = prefix[ colIndex ] + value;
+           }
+       }
+
+    return true;
+   }
@@ -0,0 +1,133 @@
+#ifndef SEGMENT_SEARCH_UTILITY_H
+#define SEGMENT_SEARCH_UTILITY_H
+
+// included headers
+#include "RB_Utility.h"
+
+// row prefix sums for the segment search, colSize + 1 per row,
+// the sum of columns a through b of a row is
+// prefix[ b + 1 ] - prefix[ a ]
+typedef struct SegmentTableStruct
+   {
+    long long *rowPrefix;
+
+    int rowSize, colSize;
+
+    bool allPositive;
+   } SegmentTableType;
+
+// one row of the segment search: column the row is entered at, total
+// before it, cells on the path above it, farthest valid column to the
+// right, end of the segment being searched below, and next end to try,
+// right ends from rightEnd back to the entry column, then left ends
+// moving away from it, below zero once the row is exhausted
+typedef struct SegmentFrameStruct
+   {
+    int entryColumn, totalBefore, pathLength;
+
+    int rightEnd, pathEnd, nextEnd;
+   } SegmentFrameType;
+
+// prototypes
+
+/*
+Name: addSegmentPath
+Process: adds the cells of every row segment on the frame stack to
+         the set, top to bottom and in the order each row was crossed,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to data array (const ArrayType *),
+                           segment frames (const SegmentFrameType []),
+                           number of frames (int)
+Function Output/Parameters: pointer to resulting set (SetType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: getArrayValue, setCellData, addItem
+*/
+bool addSegmentPath( const ArrayType *dataArray, 
+                     const SegmentFrameType frames[], int frameCount,
+                                                        SetType *foundSet );
+
+/*
+Name: clearSegmentTable
+Process: releases heap memory held by segment table, resets sizes to
+         zero, safe to call on a table that was never allocated
+Function Input/Parameters: pointer to segment table (SegmentTableType *)
+Function Output/Parameters: pointer to segment table (SegmentTableType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearSegmentTable( SegmentTableType *segmentTable );
+
+/*
+Name: enterSegmentRow
+Process: counts and tests a row entered from above at a column,
+         with the same over sum, early sum, and prune rules as
+         checkLocation; in the bottom row looks for the first segment
+         reaching the sum, right then left as findSum tries them,
+         otherwise sets the frame's farthest right end, both found by
+         binary search of the prefix sums in an all positive array,
+         returns SOLUTION_FOUND with the frame's path end set,
+         VALID_ITEM if the row can be searched past, or in the bottom
+         row with no ends left to try, otherwise the failure code
+Function Input/Parameters: pointer to search data (SearchContextType *),
+                           pointer to segment table
+                                                (const SegmentTableType *),
+                           row index (int),
+                           pointer to frame with entry column, total
+                           before the row and path length set
+                                                (SegmentFrameType *)
+Function Output/Parameters: pointer to search data with counts
+                                                (SearchContextType *),
+                            pointer to frame (SegmentFrameType *)
+Function Output/Returned: result of test (ControlCodes)
+Device Input/---: none
+Device Output/---: none
+Dependencies: findPrefixIndex, findLastBelow, isSumReachable
+*/
+ControlCodes enterSegmentRow( SearchContextType *searchData,
+                              const SegmentTableType *segmentTable,
+                              int rowIndex, SegmentFrameType *frame );
+
+/*
+Name: findSumSegments
+Process: same search and first solution as findSumIterative, but each
+         step chooses a whole row segment, the column it leaves the row
+         from, with its total from the prefix sums, rather than one cell;
+         right ends are tried farthest first, then left ends nearest
+         first, the order the cell search moves down from them,
+         keeps one frame per row and adds the full path to the set
+         only once it is found, iteration count is increased once per
+         row entered and once per left end tested, search is not traced,
+         the prefix sums of a prune table in the search data are used
+         when there is one, otherwise a table is built for this search,
+         falls back to findSumIterative if the table cannot be built
+Function Input/Parameters: pointer to search data (SearchContextType *)
+Function Output/Parameters: pointer to search data with resulting set
+                            and counts (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: initializeSegmentTable, malloc, enterSegmentRow,
+              addSegmentPath, clearSegmentTable, free, findSumIterative
+*/
+bool findSumSegments( SearchContextType *searchData );
+
+/*
+Name: initializeSegmentTable
+Process: allocates and fills the row prefix sums of the data array,
+         noting whether every value is positive,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to data array (const ArrayType *)
+Function Output/Parameters: pointer to segment table (SegmentTableType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: malloc, getArrayValue
+*/
+bool initializeSegmentTable( SegmentTableType *segmentTable,
+                                               const ArrayType *dataArray );
+
+#endif  // SEGMENT_SEARCH_UTILITY_H
@@ -0,0 +1,479 @@
+// included headers
+#include "Sum_Reach_Utility.h"
+
+/*
+Name: isReachBitSet
+Process: returns true if bitset holds the given total, false otherwise,
+         including totals outside the kept range
+Function Input/Parameters: pointer to reach table (const ReachTableType *),
+                           bitset (const uint64_t *), total (long long)
+Function Output/Parameters: none
+Function Output/Returned: result of test (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+static bool isReachBitSet( const ReachTableType *reachTable, 
+                           const uint64_t *reachBits, long long total )
+   {
+    long long bitIndex = total - reachTable->lowTotal;
+
+    if( bitIndex < 0 || bitIndex >= reachTable->bitLimit )
+       {
+        return false;
+       }
+
+    return ( reachBits[ bitIndex / REACH_WORD_BITS ] 
+                           >> ( bitIndex % REACH_WORD_BITS ) ) & 1;
+   }
+
+/*
+Name: shiftOrBits
+Process: ors source bitset shifted by cell value into destination,
+         a word at a time, moving bits up for positive values and
+         down for negative ones, bits shifted past either end are lost
+Function Input/Parameters: source bitset (const uint64_t *),
+                           shift amount (int), words per bitset (int)
+Function Output/Parameters: destination bitset (uint64_t *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+static void shiftOrBits( uint64_t *destBits, const uint64_t *sourceBits,
+                                               int shift, int wordCount )
+   {
+    long long wordShift, bitShift, index, source;
+
+    wordShift = ( shift < 0 ? -(long long)shift : shift ) / REACH_WORD_BITS;
+    bitShift = ( shift < 0 ? -(long long)shift : shift ) % REACH_WORD_BITS;
+
+    if( wordShift >= wordCount )
+       {
+        return;
+       }
+
+    if( shift >= 0 )
+       {
+        for( index = wordCount - 1; index >= wordShift; index-- )
+           {
+            source = index - wordShift;
+
+            destBits[ index ] |= sourceBits[ source ] << bitShift;
+
+            if( bitShift > 0 && source > 0 )
+               {
+                destBits[ index ] |= sourceBits[ source - 1 ] 
+                                        >> ( REACH_WORD_BITS - bitShift );
+               }
+           }
+       }
+
+    else
+       {
+        for( index = 0; index + wordShift < wordCount; index++ )
+           {
+            source = index + wordShift;
+
+            destBits[ index ] |= sourceBits[ source ] >> bitShift;
+
+            if( bitShift > 0 && source + 1 < wordCount )
+               {
+                destBits[ index ] |= sourceBits[ source + 1 ] 
+                                        << ( REACH_WORD_BITS - bitShift );
+               }
+           }
+       }
+   }
+
+/*
+Name: clearReachTable
+Process: releases heap memory held by reach table, resets sizes to zero,
+         safe to call on a table that was never allocated
+Function Input/Parameters: pointer to reach table (ReachTableType *)
+Function Output/Parameters: pointer to reach table (ReachTableType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearReachTable( ReachTableType *reachTable )
+   {
+    free( reachTable->rightReach );
+    free( reachTable->leftReach );
+
+    reachTable->rightReach = reachTable->leftReach = NULL;
+
+    reachTable->rowSize = reachTable->colSize = 0;
+
+    reachTable->wordCount = 0;
+
+    reachTable->lowTotal = reachTable->bitLimit = 0;
+   }
+
+/*
+Name: fillReachCell
+Process: sets a cell's bitset in one sweep direction to the totals 
+         entering it from above, or from the start in the top row, 
+         or from the previous cell of the sweep, shifted by its value,
+         dropping totals that reach or pass the sum since a path 
+         stops there
+Function Input/Parameters: pointer to reach table (ReachTableType *),
+                           pointer to data array (const ArrayType *),
+                           reach array for the sweep (uint64_t *),
+                           row and column index (int),
+                           previous column of the sweep (int),
+                           scratch bitset (uint64_t *)
+Function Output/Parameters: pointer to reach table (ReachTableType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: getArrayValue, getReachBits, shiftOrBits
+*/
+void fillReachCell( ReachTableType *reachTable, const ArrayType *dataArray,
+                    uint64_t *reachArray, int rowIndex, int colIndex, 
+                    int sideColumn, uint64_t *entryBits )
+   {
+    int wordIndex, wordCount = reachTable->wordCount;
+    int value = getArrayValue( dataArray, rowIndex, colIndex );
+    long long startBit = value - reachTable->lowTotal;
+    uint64_t *cellBits, *aboveRight, *aboveLeft, *sideBits;
+
+    cellBits = getReachBits( reachTable, reachArray, rowIndex, colIndex );
+
+    for( wordIndex = 0; wordIndex < wordCount; wordIndex++ )
+       {
+        entryBits[ wordIndex ] = 0;
+       }
+
+    if( rowIndex > 0 )
+       {
+        aboveRight = getReachBits( reachTable, 
+                             reachTable->rightReach, rowIndex - 1, colIndex );
+        aboveLeft = getReachBits( reachTable, 
+                              reachTable->leftReach, rowIndex - 1, colIndex );
+
+        for( wordIndex = 0; wordIndex < wordCount; wordIndex++ )
+           {
+            entryBits[ wordIndex ] 
+                           = aboveRight[ wordIndex ] | aboveLeft[ wordIndex ];
+           }
+       }
+
+    if( sideColumn >= 0 && sideColumn < reachTable->colSize )
+       {
+        sideBits = getReachBits( reachTable, reachArray, 
+                                                      rowIndex, sideColumn );
+
+        for( wordIndex = 0; wordIndex < wordCount; wordIndex++ )
+           {
+            entryBits[ wordIndex ] |= sideBits[ wordIndex ];
+           }
+       }
+
+    shiftOrBits( cellBits, entryBits, value, wordCount );
+
+    // path starting here holds just the cell value
+    if( rowIndex == 0 && startBit < reachTable->bitLimit )
+       {
+        cellBits[ startBit / REACH_WORD_BITS ] 
+                        |= (uint64_t)1 << ( startBit % REACH_WORD_BITS );
+       }
+
+    if( reachTable->bitLimit % REACH_WORD_BITS != 0 )
+       {
+        cellBits[ wordCount - 1 ] &= ( (uint64_t)1 
+                    << ( reachTable->bitLimit % REACH_WORD_BITS ) ) - 1;
+       }
+
+    else if( reachTable->bitLimit == 0 )
+       {
+        cellBits[ 0 ] = 0;
+       }
+   }
+
+/*
+Name: findReachPath
+Process: walks back from a bottom row cell reaching the sum through
+         the reach table, at each cell preferring the path from above,
+         then the one from the side it was entered, and adds the path
+         to the set in top to bottom order,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to reach table (const ReachTableType *),
+                           pointer to data array (const ArrayType *),
+                           sum requested (int), ending column (int)
+Function Output/Parameters: pointer to resulting set (SetType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: getReachBits, isReachBitSet, getArrayValue, setCellData,
+              addItem, malloc, free
+*/
+bool findReachPath( const ReachTableType *reachTable, 
+                    const ArrayType *dataArray, int sumRequest,
+                    int endColumn, SetType *foundSet )
+   {
+    int rowIndex = dataArray->rowSize - 1, colIndex = endColumn;
+    int value, pathLength = 0, index;
+    long long total = sumRequest, before;
+    bool movingRight, fromAbove;
+    CellDataType *path;
+
+    path = malloc( (size_t)dataArray->rowSize * dataArray->colSize 
+                                                   * sizeof( CellDataType ) );
+
+    if( path == NULL )
+       {
+        return false;
+       }
+
+    value = getArrayValue( dataArray, rowIndex, colIndex );
+
+    movingRight = colIndex > 0 && isReachBitSet( reachTable, 
+          getReachBits( reachTable, reachTable->rightReach, 
+                                 rowIndex, colIndex - 1 ), total - value );
+
+    while( true )
+       {
+        value = getArrayValue( dataArray, rowIndex, colIndex );
+
+        setCellData( &path[ pathLength ], value, rowIndex, colIndex );
+
+        pathLength++;
+
+        before = total - value;
+
+        if( rowIndex == 0 )
+           {
+            fromAbove = before == 0;
+           }
+
+        else
+           {
+            fromAbove = isReachBitSet( reachTable, getReachBits( reachTable, 
+                     reachTable->rightReach, rowIndex - 1, colIndex ), before )
+                     || isReachBitSet( reachTable, getReachBits( reachTable, 
+                     reachTable->leftReach, rowIndex - 1, colIndex ), before );
+           }
+
+        if( fromAbove && rowIndex == 0 )
+           {
+            break;
+           }
+
+        if( fromAbove )
+           {
+            rowIndex--;
+
+            movingRight = isReachBitSet( reachTable, getReachBits( reachTable,
+                      reachTable->rightReach, rowIndex, colIndex ), before );
+           }
+
+        else
+           {
+            colIndex += movingRight ? -1 : 1;
+           }
+
+        total = before;
+       }
+
+    for( index = pathLength - 1; index >= 0; index-- )
+       {
+        addItem( foundSet, path[ index ] );
+       }
+
+    free( path );
+
+    return true;
+   }
+
+/*
+Name: findSumReachable
+Process: answers whether any path reaches the sum with the reach table
+         instead of backtracking, in time and memory proportional to
+         cells times the range of totals, then rebuilds one witness path
+         into the set; the witness follows the same path rules as findSum
+         but need not be the path findSum finds first,
+         every top row start is considered, while the backtracking
+         engines end the search at the first start cell that fails
+         its test, so for a grid such as 6 6 1 and sum 1 this finds
+         a path where they report none,
+         iteration count is increased by the cells in the table,
+         falls back to findSumIterative if the table cannot be built
+Function Input/Parameters: pointer to search data (SearchContextType *)
+Function Output/Parameters: pointer to search data with resulting set
+                            and count (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: initializeReachTable, getReachBits, isReachBitSet,
+              getArrayValue, findReachPath, clearReachTable, 
+              findSumIterative
+*/
+bool findSumReachable( SearchContextType *searchData )
+   {
+    const ArrayType *dataArray = searchData->dataArray;
+    int lastRow = dataArray->rowSize - 1, colIndex, value;
+    long long before;
+    ReachTableType reachTable;
+    bool found = false;
+
+    if( !initializeReachTable( &reachTable, dataArray, 
+                                                  searchData->sumRequest ) )
+       {
+        return findSumIterative( searchData );
+       }
+
+    searchData->iterationCount += dataArray->rowSize * dataArray->colSize;
+
+    for( colIndex = 0; !found && colIndex < dataArray->colSize; colIndex++ )
+       {
+        value = getArrayValue( dataArray, lastRow, colIndex );
+
+        before = (long long)searchData->sumRequest - value;
+
+        // entered from above or from either side with the rest of the sum
+        found = ( lastRow == 0 ? before == 0 
+                : isReachBitSet( &reachTable, getReachBits( &reachTable, 
+                      reachTable.rightReach, lastRow - 1, colIndex ), before )
+               || isReachBitSet( &reachTable, getReachBits( &reachTable, 
+                      reachTable.leftReach, lastRow - 1, colIndex ), before ) )
+             || ( colIndex > 0 && isReachBitSet( &reachTable, 
+                      getReachBits( &reachTable, reachTable.rightReach, 
+                                         lastRow, colIndex - 1 ), before ) )
+             || ( colIndex < dataArray->colSize - 1 && isReachBitSet( 
+                      &reachTable, getReachBits( &reachTable, 
+                      reachTable.leftReach, lastRow, colIndex + 1 ), before ) );
+
+        if( found )
+           {
+            found = findReachPath( &reachTable, dataArray, 
+                     searchData->sumRequest, colIndex, searchData->foundSet );
+           }
+       }
+
+    clearReachTable( &reachTable );
+
+    return found;
+   }
+
+/*
+Name: getReachBits
+Process: returns start of a cell's bitset in the given reach array
+Function Input/Parameters: pointer to reach table (const ReachTableType *),
+                           reach array (uint64_t *), 
+                           row and column index (int)
+Function Output/Parameters: none
+Function Output/Returned: cell bitset (uint64_t *)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+uint64_t *getReachBits( const ReachTableType *reachTable, 
+                        uint64_t *reachArray, int rowIndex, int colIndex )
+   {
+    return reachArray + ( (size_t)rowIndex * reachTable->colSize + colIndex )
+                                                    * reachTable->wordCount;
+   }
+
+/*
+Name: initializeReachTable
+Process: sizes the bitsets from the lowest total any path can hold, the
+         sum of all negative cells, up to one below the requested sum,
+         then fills them a row at a time with a right sweep and a left
+         sweep of fillReachCell; returns true if successful, false if
+         the table would pass MAX_REACH_BYTES or cannot be allocated
+Function Input/Parameters: pointer to data array (const ArrayType *),
+                           sum requested (int)
+Function Output/Parameters: pointer to reach table (ReachTableType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: getArrayValue, fillReachCell, calloc, free, clearReachTable
+*/
+bool initializeReachTable( ReachTableType *reachTable, 
+                           const ArrayType *dataArray, int sumRequest )
+   {
+    int rowIndex, colIndex, value, wordCount;
+    int rowSize = dataArray->rowSize, colSize = dataArray->colSize;
+    long long lowTotal = 0, bitLimit;
+    size_t cellCount = (size_t)rowSize * colSize;
+    uint64_t *entryBits;
+
+    reachTable->rightReach = reachTable->leftReach = NULL;
+
+    for( rowIndex = 0; rowIndex < rowSize; rowIndex++ )
+       {
+        for( colIndex = 0; colIndex < colSize; colIndex++ )
+           {
+            value = getArrayValue( dataArray, rowIndex, colIndex );
+
+            if( value < 0 )
+               {
+                lowTotal += value;
+               }
+           }
+       }
+
+    bitLimit = (long long)sumRequest - lowTotal;
+
+    if( bitLimit < 0 )
+       {
+        bitLimit = 0;
+       }
+
+    if( cellCount == 0 || bitLimit > (long long)MAX_REACH_BYTES * CHAR_BIT )
+       {
+        return false;
+       }
+
+    wordCount = bitLimit > 0 
+          ? (int)( ( bitLimit + REACH_WORD_BITS - 1 ) / REACH_WORD_BITS ) : 1;
+
+    if( 2 * cellCount + 1 
+                   > MAX_REACH_BYTES / ( wordCount * sizeof( uint64_t ) ) )
+       {
+        return false;
+       }
+
+    reachTable->rightReach = calloc( cellCount * wordCount, 
+                                                       sizeof( uint64_t ) );
+    reachTable->leftReach = calloc( cellCount * wordCount, 
+                                                       sizeof( uint64_t ) );
+    entryBits = malloc( wordCount * sizeof( uint64_t ) );
+
+    reachTable->rowSize = rowSize;
+    reachTable->colSize = colSize;
+    reachTable->wordCount = wordCount;
+    reachTable->lowTotal = lowTotal;
+    reachTable->bitLimit = bitLimit;
+
+    if( reachTable->rightReach == NULL || reachTable->leftReach == NULL
+                                                      || entryBits == NULL )
+       {
+        free( entryBits );
+
+        clearReachTable( reachTable );
+
+        return false;
+       }
+
+    for( rowIndex = 0; rowIndex < rowSize; rowIndex++ )
+       {
+        for( colIndex = 0; colIndex < colSize; colIndex++ )
+           {
+            fillReachCell( reachTable, dataArray, reachTable->rightReach,
+                             rowIndex, colIndex, colIndex - 1, entryBits );
+           }
+
+        for( colIndex = colSize - 1; colIndex >= 0; colIndex-- )
+           {
+            fillReachCell( reachTable, dataArray, reachTable->leftReach,
+                             rowIndex, colIndex, colIndex + 1, entryBits );
+           }
+       }
+
+    free( entryBits );
+
+    return true;
+   }
@@ -0,0 +1,144 @@
+#ifndef SUM_REACH_UTILITY_H
+#define SUM_REACH_UTILITY_H
+
+// included headers
+#include "RB_Utility.h"
+
+// local constants
+typedef enum { REACH_WORD_BITS = 64, 
+               MAX_REACH_BYTES = 1 << 30 } ReachData;
+
+// reachable totals for every cell, one bitset per cell for paths that
+// arrive moving right (or from above) and one for paths moving left;
+// bit b of a cell's set means a path can include the cell with total
+// lowTotal + b, only totals below the requested sum are kept,
+// bitsets are row-major with wordCount words each
+typedef struct ReachTableStruct
+   {
+    uint64_t *rightReach, *leftReach;
+
+    int rowSize, colSize;
+
+    int wordCount;
+
+    long long lowTotal, bitLimit;
+   } ReachTableType;
+
+// prototypes
+
+/*
+Name: clearReachTable
+Process: releases heap memory held by reach table, resets sizes to zero,
+         safe to call on a table that was never allocated
+Function Input/Parameters: pointer to reach table (ReachTableType *)
+Function Output/Parameters: pointer to reach table (ReachTableType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: free
+*/
+void clearReachTable( ReachTableType *reachTable );
+
+/*
+Name: fillReachCell
+Process: sets a cell's bitset in one sweep direction to the totals 
+         entering it from above, or from the start in the top row, 
+         or from the previous cell of the sweep, shifted by its value,
+         dropping totals that reach or pass the sum since a path 
+         stops there
+Function Input/Parameters: pointer to reach table (ReachTableType *),
+                           pointer to data array (const ArrayType *),
+                           reach array for the sweep (uint64_t *),
+                           row and column index (int),
+                           previous column of the sweep (int),
+                           scratch bitset (uint64_t *)
+Function Output/Parameters: pointer to reach table (ReachTableType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: getArrayValue, getReachBits, shiftOrBits
+*/
+void fillReachCell( ReachTableType *reachTable, const ArrayType *dataArray,
+                    uint64_t *reachArray, int rowIndex, int colIndex, 
+                    int sideColumn, uint64_t *entryBits );
+
+/*
+Name: findReachPath
+Process: walks back from a bottom row cell reaching the sum through
+         the reach table, at each cell preferring the path from above,
+         then the one from the side it was entered, and adds the path
+         to the set in top to bottom order,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to reach table (const ReachTableType *),
+                           pointer to data array (const ArrayType *),
+                           sum requested (int), ending column (int)
+Function Output/Parameters: pointer to resulting set (SetType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: getReachBits, isReachBitSet, getArrayValue, setCellData,
+              addItem, malloc, free
+*/
+bool findReachPath( const ReachTableType *reachTable, 
+                    const ArrayType *dataArray, int sumRequest,
+                    int endColumn, SetType *foundSet );
+
+/*
+Name: findSumReachable
+Process: answers whether any path reaches the sum with the reach table
+         instead of backtracking, in time and memory proportional to
+         cells times the range of totals, then rebuilds one witness path
+         into the set; the witness follows the same path rules as findSum
+         but need not be the path findSum finds first,
+         every top row start is considered, while the backtracking
+         engines end the search at the first start cell that fails
+         its test, so for a grid such as 6 6 1 and sum 1 this finds
+         a path where they report none,
+         iteration count is increased by the cells in the table,
+         falls back to findSumIterative if the table cannot be built
+Function Input/Parameters: pointer to search data (SearchContextType *)
+Function Output/Parameters: pointer to search data with resulting set
+                            and count (SearchContextType *)
+Function Output/Returned: result of search (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: initializeReachTable, getReachBits, isReachBitSet,
+              getArrayValue, findReachPath, clearReachTable, 
+              findSumIterative
+*/
+bool findSumReachable( SearchContextType *searchData );
+
+/*
+Name: getReachBits
+Process: returns start of a cell's bitset in the given reach array
+Function Input/Parameters: pointer to reach table (const ReachTableType *),
+                           reach array (uint64_t *), 
+                           row and column index (int)
+Function Output/Parameters: none
+Function Output/Returned: cell bitset (uint64_t *)
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+uint64_t *getReachBits( const ReachTableType *reachTable, 
+                        uint64_t *reachArray, int rowIndex, int colIndex );
+
+/*
+Name: initializeReachTable
+Process: sizes the bitsets from the lowest total any path can hold, the
+         sum of all negative cells, up to one below the requested sum,
+         then fills them a row at a time with a right sweep and a left
+         sweep of fillReachCell; returns true if successful, false if
+         the table would pass MAX_REACH_BYTES or cannot be allocated
+Function Input/Parameters: pointer to data array (const ArrayType *),
+                           sum requested (int)
+Function Output/Parameters: pointer to reach table (ReachTableType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: getArrayValue, fillReachCell, calloc, free, clearReachTable
+*/
+bool initializeReachTable( ReachTableType *reachTable, 
+                           const ArrayType *dataArray, int sumRequest );
+
+#endif  // SUM_REACH_UTILITY_H
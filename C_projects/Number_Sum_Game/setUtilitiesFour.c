@@ -1,25 +1,97 @@
 #include "SetUtilitiesFour.h"
 
+/*
+Name: getVisitedBit
+Process: finds bitmap word and bit mask for cell location in grid set,
+         returns true if set has a bitmap and the location is in the grid,
+         false otherwise
+Function Input/Parameters: pointer to set (const SetType *), 
+                           cell to locate (CellDataType)
+Function Output/Parameters: word index (size_t *), bit mask (uint64_t *)
+Function Output/Returned: Boolean result of action
+Device Input/---: none
+Device Output/---: none
+Dependencies: none
+*/
+static bool getVisitedBit( const SetType *setData, CellDataType cell,
+                                         size_t *wordIndex, uint64_t *bitMask )
+   {
+    size_t cellIndex;
+
+    if( setData->visitedMap == NULL 
+        || cell.xLocation < 0 || cell.xLocation >= setData->mapRows
+        || cell.yLocation < 0 || cell.yLocation >= setData->mapCols )
+       {
+        return false;
+       }
+
+    cellIndex = (size_t)cell.xLocation * setData->mapCols + cell.yLocation;
+
+    *wordIndex = cellIndex / VISITED_WORD_BITS;
+
+    *bitMask = (uint64_t)1 << ( cellIndex % VISITED_WORD_BITS );
+
+    return true;
+   }
+
 /*
 Name: addItem
 Process: adds cell item to set, does not allow duplicates,
          does not allow data to be added to full list (MAX_SET_CAPACITY),
+         grid sets grow their list as needed up to one entry per grid cell,
          returns true if successful, false otherwise
 Function Input/Parameters: new item (CellDataType)
 Function Output/Parameters: pointer to set data (SetType *)
 Function Output/Returned: Boolean result of action
 Device Input/---: none
 Device Output/---: none
-Dependencies: isInSet, copyCell
+Dependencies: isInSet, copyCell, realloc
 */
 bool addItem( SetType *setData, CellDataType newValue )
    {
-    if( setData->size < setData->capacity && !isInSet( *setData, newValue ) )
+    size_t wordIndex, maxCapacity;
+    uint64_t bitMask = 0;
+    bool hasBit = getVisitedBit( setData, newValue, &wordIndex, &bitMask );
+    CellDataType *newArray;
+
+    if( hasBit ? ( setData->visitedMap[ wordIndex ] & bitMask ) != 0
+               : isInSet( *setData, newValue ) )
+       {
+        return false;
+       }
+
+    if( setData->size == setData->capacity && setData->visitedMap != NULL )
+       {
+        maxCapacity = (size_t)setData->mapRows * setData->mapCols;
+
+        if( (size_t)setData->capacity < maxCapacity )
+           {
+            maxCapacity = (size_t)setData->capacity * 2 < maxCapacity 
+                                ? (size_t)setData->capacity * 2 : maxCapacity;
+
+            newArray = realloc( setData->setArray, 
+                                         maxCapacity * sizeof( CellDataType ) );
+
+            if( newArray != NULL )
+               {
+                setData->setArray = newArray;
+
+                setData->capacity = (int)maxCapacity;
+               }
+           }
+       }
+
+    if( setData->size < setData->capacity )
        {
         copyCell( &setData->setArray[ setData->size ], newValue );
 
         setData->size++;
 
+        if( hasBit )
+           {
+            setData->visitedMap[ wordIndex ] |= bitMask;
+           }
+
         return true;
        }
 
@@ -27,27 +99,109 @@ bool addItem( SetType *setData, CellDataType newValue )
    }
 
 /*
-Name: copySet
-Process: copies all data of one set into other
-Function Input/Parameters: source set (const SetType)
-Function Output/Parameters: destination set (SetType)
+Name: clearSet
+Process: releases heap memory held by set, leaves set empty
+Function Input/Parameters: pointer to set (SetType *)
+Function Output/Parameters: pointer to set (SetType *)
 Function Output/Returned: none
 Device Input/---: none
 Device Output/---: none
-Dependencies: copyCell
+Dependencies: free
+*/
+void clearSet( SetType *set )
+   {
+    free( set->setArray );
+
+    free( set->visitedMap );
+
+    set->setArray = NULL;
+
+    set->visitedMap = NULL;
+
+    set->mapRows = set->mapCols = 0;
+
+    set->capacity = 0;
+
+    set->size = 0;
+   }
+
+/*
+Name: copySet
+Process: copies all data of one set into other, growing the destination
+         list to hold every source item and copying the source visited
+         bitmap and grid size, so membership tests give the same results,
+         destination is unchanged if memory cannot be allocated,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to source set (const SetType *)
+Function Output/Parameters: pointer to destination set (SetType *)
+Function Output/Returned: Boolean result of action
+Device Input/---: none
+Device Output/---: none
+Dependencies: malloc, realloc, free, copyCell
 */
-void copySet( SetType dest, const SetType source )
+bool copySet( SetType *dest, const SetType *source )
    {
     int index;
+    size_t wordIndex, wordCount = 0;
+    uint64_t *newMap = NULL;
+    CellDataType *newArray;
+
+    if( dest == source )
+       {
+        return true;
+       }
 
-    for( index = 0; index < source.size; index++ )
+    if( source->visitedMap != NULL )
        {
-        copyCell( &dest.setArray[ index ], source.setArray[ index ] );
+        wordCount = ( (size_t)source->mapRows * source->mapCols 
+                               + VISITED_WORD_BITS - 1 ) / VISITED_WORD_BITS;
+
+        newMap = malloc( wordCount * sizeof( uint64_t ) );
+
+        if( newMap == NULL )
+           {
+            return false;
+           }
        }
 
-    dest.capacity = source.capacity;
+    if( dest->capacity < source->size )
+       {
+        newArray = realloc( dest->setArray, 
+                                   source->size * sizeof( CellDataType ) );
+
+        if( newArray == NULL )
+           {
+            free( newMap );
 
-    dest.size = source.size;
+            return false;
+           }
+
+        dest->setArray = newArray;
+
+        dest->capacity = source->size;
+       }
+
+    for( wordIndex = 0; wordIndex < wordCount; wordIndex++ )
+       {
+        newMap[ wordIndex ] = source->visitedMap[ wordIndex ];
+       }
+
+    free( dest->visitedMap );
+
+    dest->visitedMap = newMap;
+
+    dest->mapRows = source->mapRows;
+
+    dest->mapCols = source->mapCols;
+
+    for( index = 0; index < source->size; index++ )
+       {
+        copyCell( &dest->setArray[ index ], source->setArray[ index ] );
+       }
+
+    dest->size = source->size;
+
+    return true;
    }
 
 /*
@@ -55,6 +209,7 @@ Name: deleteItem
 Process: searches for item by value, deletes if found,
          moves array data down by one from above the removed value,
          test loop must stop as soon as item is found (if it is found),
+         removing the most recently added item takes constant time,
          returns true if item found and removed, false otherwise
 Function Input/Parameters: item to delete (CellDataType)
 Function Output/Parameters: pointer to setData (SetType *) 
@@ -67,6 +222,24 @@ bool deleteItem( SetType *setData, CellDataType itemToDelete )
    {
     int index = 0;
     bool found = false;
+    size_t wordIndex;
+    uint64_t bitMask = 0;
+    bool hasBit = getVisitedBit( setData, itemToDelete, 
+                                                     &wordIndex, &bitMask );
+
+    if( hasBit && ( setData->visitedMap[ wordIndex ] & bitMask ) == 0 )
+       {
+        return false;
+       }
+
+    // backtracking always removes the last item, test it first
+    if( setData->size > 0 && cellsAreEqual( 
+                    setData->setArray[ setData->size - 1 ], itemToDelete ) )
+       {
+        index = setData->size - 1;
+
+        found = true;
+       }
 
     while( index < setData->size && !found )
        {
@@ -82,6 +255,12 @@ bool deleteItem( SetType *setData, CellDataType itemToDelete )
 
     if( found )
        {
+        // location is only free once the matching item is removed
+        if( hasBit )
+           {
+            setData->visitedMap[ wordIndex ] &= ~bitMask;
+           }
+
         setData->size--;
 
         while( index < setData->size )
@@ -147,19 +326,86 @@ void displaySet( const char *setName, const SetType setData )
     printf( "\n" );
    }
 
+/*
+Name: emptySet
+Process: removes every item, last first, keeping the allocated list 
+         and visited bitmap for reuse
+Function Input/Parameters: pointer to setData (SetType *)
+Function Output/Parameters: pointer to setData (SetType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: deleteItem
+*/
+void emptySet( SetType *setData )
+   {
+    while( setData->size > 0 )
+       {
+        deleteItem( setData, setData->setArray[ setData->size - 1 ] );
+       }
+   }
+
+/*
+Name: initializeGridSet
+Process: initializes empty set for cells of a grid with given dimensions,
+         allocates visited bitmap for constant time membership tests,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to set (SetType *), 
+                           grid rows and columns (int)
+Function Output/Parameters: pointer to set (SetType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: initializeSet, calloc
+*/
+bool initializeGridSet( SetType *set, int rowSize, int colSize )
+   {
+    size_t numWords;
+
+    initializeSet( set );
+
+    if( set->setArray == NULL || rowSize <= 0 || colSize <= 0 )
+       {
+        return false;
+       }
+
+    numWords = ( (size_t)rowSize * colSize + VISITED_WORD_BITS - 1 ) 
+                                                          / VISITED_WORD_BITS;
+
+    set->visitedMap = calloc( numWords, sizeof( uint64_t ) );
+
+    if( set->visitedMap == NULL )
+       {
+        return false;
+       }
+
+    set->mapRows = rowSize;
+
+    set->mapCols = colSize;
+
+    return true;
+   }
+
 /*
 Name: initializeSet
-Process: initializes empty set for use
+Process: initializes empty set for use, capacity MAX_SET_CAPACITY,
+         set must be released with clearSet
 Function Input/Parameters: pointer to set (SetType *)
 Function Output/Parameters: pointer to set (SetType *)
 Function Output/Returned: none
 Device Input/---: none
 Device Output/---: none
-Dependencies: none
+Dependencies: malloc
 */
 void initializeSet( SetType *set )
    {
-    set->capacity = MAX_SET_CAPACITY;
+    set->setArray = malloc( MAX_SET_CAPACITY * sizeof( CellDataType ) );
+
+    set->visitedMap = NULL;
+
+    set->mapRows = set->mapCols = 0;
+
+    set->capacity = set->setArray != NULL ? MAX_SET_CAPACITY : 0;
 
     set->size = 0;
    }
@@ -168,7 +414,8 @@ void initializeSet( SetType *set )
 Name: isInSet
 Process: searches for given value in set,
          if found, returns true, otherwise returns false,
-         must return found result immediately upon finding value
+         must return found result immediately upon finding value,
+         grid sets answer from the visited bitmap in constant time
 Function Input/Parameters: set (const SetType), search value (CellDataType)
 Function Output/Parameters: none
 Function Output/Returned: Boolean result of test, as specified
@@ -179,6 +426,13 @@ Dependencies: cellsAreEqual
 bool isInSet( const SetType testSet, CellDataType searchVal )
    {
     int index;
+    size_t wordIndex;
+    uint64_t bitMask;
+
+    if( getVisitedBit( &testSet, searchVal, &wordIndex, &bitMask ) )
+       {
+        return ( testSet.visitedMap[ wordIndex ] & bitMask ) != 0;
+       }
 
     for( index = 0; index < testSet.size; index++ )
        {
@@ -4,6 +4,7 @@
 // headers/libraries
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include "StandardConstants.h"
 #include "CellUtility.h"
 
@@ -13,9 +14,18 @@ typedef enum { MAX_SET_CAPACITY = 100,
                                    MAX_INIT_SET_CAPACITY = 50 } ArrayCapacities;
 typedef enum { THREE_DIGIT_LOW = 100, THREE_DIGIT_HIGH = 999 } RandomLimits;
 
+typedef enum { VISITED_WORD_BITS = 64 } VisitedMapData;
+
+// ordered path of cells; grid sets also keep a visited bitmap
+// indexed by xLocation * mapCols + yLocation for constant time membership,
+// plain sets leave visitedMap NULL and search setArray linearly
 typedef struct SetStruct
    {
-    CellDataType setArray[ MAX_SET_CAPACITY ];
+    CellDataType *setArray;
+
+    uint64_t *visitedMap;
+
+    int mapRows, mapCols;
 
     int capacity;
 
@@ -28,33 +38,51 @@ typedef struct SetStruct
 Name: addItem
 Process: adds cell item to set, does not allow duplicates,
          does not allow data to be added to full list,
+         grid sets grow their list as needed up to one entry per grid cell,
          returns true if successful, false otherwise
 Function Input/Parameters: new item (CellDataType)
 Function Output/Parameters: pointer to set data (SetType *)
 Function Output/Returned: Boolean result of action
 Device Input/---: none
 Device Output/---: none
-Dependencies: isInSet, copyCell
+Dependencies: isInSet, copyCell, realloc
 */
 bool addItem( SetType *setData, CellDataType newValue );
 
 /*
-Name: copySet
-Process: copies all data of one set into other
-Function Input/Parameters: source set (const SetType)
-Function Output/Parameters: pointer to destination set (SetType)
+Name: clearSet
+Process: releases heap memory held by set, leaves set empty
+Function Input/Parameters: pointer to set (SetType *)
+Function Output/Parameters: pointer to set (SetType *)
 Function Output/Returned: none
 Device Input/---: none
 Device Output/---: none
-Dependencies: copyCell
+Dependencies: free
+*/
+void clearSet( SetType *set );
+
+/*
+Name: copySet
+Process: copies all data of one set into other, growing the destination
+         list to hold every source item and copying the source visited
+         bitmap and grid size, so membership tests give the same results,
+         destination is unchanged if memory cannot be allocated,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to source set (const SetType *)
+Function Output/Parameters: pointer to destination set (SetType *)
+Function Output/Returned: Boolean result of action
+Device Input/---: none
+Device Output/---: none
+Dependencies: malloc, realloc, free, copyCell
 */
-void copySet( SetType dest, const SetType source );
+bool copySet( SetType *dest, const SetType *source );
 
 /*
 Name: deleteItem
 Process: searches for cell item, deletes if found,
          moves array data down by one from above the removed value,
          test loop must stop as soon as item is found (if it is found),
+         removing the most recently added item takes constant time,
          returns true if item found and removed, false otherwise
 Function Input/Parameters: item to delete (CellDataType)
 Function Output/Parameters: pointer to setData (SetType *) 
@@ -78,15 +106,44 @@ Dependencies: printf, cellToString
 */
 void displaySet( const char *setName, const SetType setData );
 
+/*
+Name: emptySet
+Process: removes every item, last first, keeping the allocated list 
+         and visited bitmap for reuse
+Function Input/Parameters: pointer to setData (SetType *)
+Function Output/Parameters: pointer to setData (SetType *)
+Function Output/Returned: none
+Device Input/---: none
+Device Output/---: none
+Dependencies: deleteItem
+*/
+void emptySet( SetType *setData );
+
+/*
+Name: initializeGridSet
+Process: initializes empty set for cells of a grid with given dimensions,
+         allocates visited bitmap for constant time membership tests,
+         returns true if successful, false otherwise
+Function Input/Parameters: pointer to set (SetType *), 
+                           grid rows and columns (int)
+Function Output/Parameters: pointer to set (SetType *)
+Function Output/Returned: success of operation (bool)
+Device Input/---: none
+Device Output/---: none
+Dependencies: initializeSet, calloc
+*/
+bool initializeGridSet( SetType *set, int rowSize, int colSize );
+
 /*
 Name: initializeSet
-Process: initializes empty set for use
+Process: initializes empty set for use, capacity MAX_SET_CAPACITY,
+         set must be released with clearSet
 Function Input/Parameters: pointer to set (SetType *)
 Function Output/Parameters: pointer to set (SetType *)
 Function Output/Returned: none
 Device Input/---: none
 Device Output/---: none
-Dependencies: none
+Dependencies: malloc
 */
 void initializeSet( SetType *set );
 
@@ -94,7 +151,8 @@ void initializeSet( SetType *set );
 Name: isInSet
 Process: searches for given value in set,
          if found, returns true, otherwise returns false,
-         must return found result immediately upon finding value
+         must return found result immediately upon finding value,
+         grid sets answer from the visited bitmap in constant time
 Function Input/Parameters: set (const SetType), search value (CellDataType)
 Function Output/Parameters: none
 Function Output/Returned: Boolean result of test, as specified
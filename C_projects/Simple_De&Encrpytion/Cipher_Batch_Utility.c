@@ -0,0 +1,936 @@
+// POSIX declarations for the monotonic clock, set before any system header
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+// header files
+#include <limits.h>
+#include "Cipher_Batch_Utility.h"
+#include "Random_Utility.h"
+
+#ifdef CIPHER_BATCH_X86
+#include <immintrin.h>
+#endif
+
+// local constants, used only in this file
+
+// timed runs of each kernel, best run reported
+static const int BENCHMARK_REPEATS = 5;
+
+// fixed seed, every run times the same text
+static const uint64_t BENCHMARK_SEED = 8;
+
+// bytes in one megabyte, bytes in one gigabyte
+static const size_t BYTES_PER_MEGABYTE = 1048576;
+static const double BYTES_PER_GIGABYTE = 1.0e9;
+
+/*
+Name: decryptValuesScalar
+process: translates encrypted values to characters one at a time,
+         starting at the given value
+Function input/parameters: batch cipher tables (const CipherBatchType *),
+                           encrypted values (const int []),
+                           first value (int), number of values (int)
+Function output/parameters: decrypted characters (char [])
+Function output/returned: none
+Device input/file: none
+Device output/monitor: none
+Dependencies: none
+*/
+static void decryptValuesScalar( const CipherBatchType *cipherBatch,
+                 const int values[], char chars[], int start, int count )
+   {
+    // initialize variables
+    int index, row, column;
+
+    // loop across values from start
+    for( index = start; index < count; index++ )
+       {
+        // split tens digit to row, ones digit to column
+        row = values[ index ] / TENS_MULTIPLIER % TENS_MULTIPLIER;
+        column = values[ index ] % TENS_MULTIPLIER;
+
+        // look up character at row and column
+        chars[ index ] = cipherBatch->cellChars[ row * CELL_SIDE + column ];
+       }
+   }
+
+/*
+Name: encryptCharactersScalar
+process: encrypts characters one at a time, starting at the given
+         character, stops at first character not in the lookup table
+Function input/parameters: batch cipher tables (const CipherBatchType *),
+                           characters to encrypt (const char []),
+                           random first digits (const unsigned char []),
+                           first character (int), number of characters (int)
+Function output/parameters: encrypted values (int [])
+Function output/returned: index of first character not encrypted (int)
+Device input/file: none
+Device output/monitor: none
+Dependencies: none
+*/
+static int encryptCharactersScalar( const CipherBatchType *cipherBatch,
+                   const char chars[], const unsigned char randDigits[],
+                                        int values[], int start, int count )
+   {
+    // initialize variables
+    int index;
+    unsigned char code, packed;
+
+    // loop across characters from start
+    for( index = start; index < count; index++ )
+       {
+        // look up packed digits by high and low nibble of character
+        code = (unsigned char)chars[ index ];
+        packed = cipherBatch->packedCells[ code >> 4 ][ code & 0x0F ];
+
+        // check for character not in table
+        if( packed == NO_CELL )
+           {
+            // stop at character
+            return index;
+           }
+
+        // add random digit as hundreds digit
+        values[ index ] = randDigits[ index ] * HUNDREDS_MULTIPLIER + packed;
+       }
+
+    // return all characters encrypted
+    return count;
+   }
+
+/*
+Name: getSeconds
+process: reads the monotonic clock
+Function input/parameters: none
+Function output/parameters: none
+Function output/returned: clock time in seconds (double)
+Device input/file: none
+Device output/monitor: none
+Dependencies: clock_gettime
+*/
+static double getSeconds()
+   {
+    // initialize variables
+    struct timespec now;
+
+    // read clock
+       // function: clock_gettime
+    clock_gettime( CLOCK_MONOTONIC, &now );
+
+    // return seconds with fraction
+    return (double)now.tv_sec + (double)now.tv_nsec / 1.0e9;
+   }
+
+#ifdef CIPHER_BATCH_X86
+
+/*
+Name: cellsFromValuesSsse3
+process: splits eight 16 bit encrypted values into row and column digits
+         with multiply high division by ten, gives row * 8 + column,
+         the hundreds digit drops out
+Function input/parameters: encrypted values (__m128i)
+Function output/parameters: none
+Function output/returned: table cells (__m128i)
+Device input/file: none
+Device output/monitor: none
+Dependencies: SSE2 intrinsics
+*/
+__attribute__(( target( "ssse3" ) ))
+static inline __m128i cellsFromValuesSsse3( __m128i values )
+   {
+    // initialize variables, column is ones digit, row is tens digit
+       // function: _mm_set1_epi16, _mm_mulhi_epu16, _mm_mullo_epi16,
+       //           _mm_sub_epi16
+    const __m128i divideTen = _mm_set1_epi16( DIVIDE_TEN_MULTIPLIER );
+    const __m128i ten = _mm_set1_epi16( TENS_MULTIPLIER );
+    __m128i tens = _mm_mulhi_epu16( values, divideTen );
+    __m128i column = _mm_sub_epi16( values, _mm_mullo_epi16( tens, ten ) );
+    __m128i row = _mm_sub_epi16( tens,
+                 _mm_mullo_epi16( _mm_mulhi_epu16( tens, divideTen ), ten ) );
+
+    // return row * 8 + column
+       // function: _mm_slli_epi16, _mm_or_si128
+    return _mm_or_si128( _mm_slli_epi16( row, 3 ), column );
+   }
+
+/*
+Name: cellsFromValuesAvx2
+process: splits sixteen 16 bit encrypted values into row and column digits
+         with multiply high division by ten, gives row * 8 + column,
+         the hundreds digit drops out
+Function input/parameters: encrypted values (__m256i)
+Function output/parameters: none
+Function output/returned: table cells (__m256i)
+Device input/file: none
+Device output/monitor: none
+Dependencies: AVX2 intrinsics
+*/
+__attribute__(( target( "avx2" ) ))
+static inline __m256i cellsFromValuesAvx2( __m256i values )
+   {
+    // initialize variables, column is ones digit, row is tens digit
+       // function: _mm256_set1_epi16, _mm256_mulhi_epu16,
+       //           _mm256_mullo_epi16, _mm256_sub_epi16
+    const __m256i divideTen = _mm256_set1_epi16( DIVIDE_TEN_MULTIPLIER );
+    const __m256i ten = _mm256_set1_epi16( TENS_MULTIPLIER );
+    __m256i tens = _mm256_mulhi_epu16( values, divideTen );
+    __m256i column = _mm256_sub_epi16( values,
+                                           _mm256_mullo_epi16( tens, ten ) );
+    __m256i row = _mm256_sub_epi16( tens, _mm256_mullo_epi16(
+                               _mm256_mulhi_epu16( tens, divideTen ), ten ) );
+
+    // return row * 8 + column
+       // function: _mm256_slli_epi16, _mm256_or_si256
+    return _mm256_or_si256( _mm256_slli_epi16( row, 3 ), column );
+   }
+
+/*
+Name: decryptValuesAvx2
+process: translates 32 values per step: packs them to 16 bits,
+         splits digits, packs cells to bytes, looks each cell up with
+         four in-lane byte shuffles over the 64 character table,
+         restores value order with one cross-lane permute,
+         remaining values done by the scalar kernel
+Function input/parameters: batch cipher tables (const CipherBatchType *),
+                           encrypted values (const int []),
+                           number of values (int)
+Function output/parameters: decrypted characters (char [])
+Function output/returned: none
+Device input/file: none
+Device output/monitor: none
+Dependencies: AVX2 intrinsics, cellsFromValuesAvx2, decryptValuesScalar
+*/
+__attribute__(( target( "avx2" ) ))
+static void decryptValuesAvx2( const CipherBatchType *cipherBatch,
+                                const int values[], char chars[], int count )
+   {
+    // initialize variables
+       // function: _mm256_set1_epi8, _mm256_setr_epi32
+    const __m256i lowMask = _mm256_set1_epi8( 0x0F );
+    const __m256i valueOrder = _mm256_setr_epi32( 0, 4, 1, 5, 2, 6, 3, 7 );
+    __m256i tableRows[ CELL_COUNT / NIBBLE_COUNT ];
+    __m256i first, second, cells, low, quarter, match, text;
+    const __m256i *source;
+    int index, row;
+
+    // broadcast each 16 character quarter of the table to both lanes
+    for( row = 0; row < CELL_COUNT / NIBBLE_COUNT; row++ )
+       {
+           // function: _mm256_broadcastsi128_si256, _mm_loadu_si128
+        tableRows[ row ] = _mm256_broadcastsi128_si256( _mm_loadu_si128(
+           (const __m128i *)&cipherBatch->cellChars[ row * NIBBLE_COUNT ] ) );
+       }
+
+    // loop across full vector steps
+    for( index = 0; index + AVX2_STEP <= count; index += AVX2_STEP )
+       {
+        source = (const __m256i *)&values[ index ];
+
+        // pack to 16 bits, lanes interleave, put right after lookup
+           // function: _mm256_packs_epi32, _mm256_loadu_si256
+        first = _mm256_packs_epi32( _mm256_loadu_si256( source ),
+                                    _mm256_loadu_si256( source + 1 ) );
+        second = _mm256_packs_epi32( _mm256_loadu_si256( source + 2 ),
+                                     _mm256_loadu_si256( source + 3 ) );
+
+        // split digits to cells, pack cells to bytes
+           // function: _mm256_packus_epi16, cellsFromValuesAvx2
+        cells = _mm256_packus_epi16( cellsFromValuesAvx2( first ),
+                                     cellsFromValuesAvx2( second ) );
+
+        // low nibble picks the character, high nibble picks the quarter
+           // function: _mm256_and_si256, _mm256_srli_epi16,
+           //           _mm256_setzero_si256
+        low = _mm256_and_si256( cells, lowMask );
+        quarter = _mm256_and_si256( _mm256_srli_epi16( cells, 4 ), lowMask );
+        text = _mm256_setzero_si256();
+
+        // keep each quarter's lookup where the quarter matches
+        for( row = 0; row < CELL_COUNT / NIBBLE_COUNT; row++ )
+           {
+               // function: _mm256_cmpeq_epi8, _mm256_set1_epi8,
+               //           _mm256_or_si256, _mm256_and_si256,
+               //           _mm256_shuffle_epi8
+            match = _mm256_cmpeq_epi8( quarter, _mm256_set1_epi8( (char)row ) );
+            text = _mm256_or_si256( text, _mm256_and_si256( match,
+                             _mm256_shuffle_epi8( tableRows[ row ], low ) ) );
+           }
+
+        // restore value order, store characters
+           // function: _mm256_storeu_si256, _mm256_permutevar8x32_epi32
+        _mm256_storeu_si256( (__m256i *)&chars[ index ],
+                          _mm256_permutevar8x32_epi32( text, valueOrder ) );
+       }
+
+    // translate remaining values
+       // function: decryptValuesScalar
+    decryptValuesScalar( cipherBatch, values, chars, index, count );
+   }
+
+/*
+Name: decryptValuesSsse3
+process: translates 16 values per step: packs them to 16 bits,
+         splits digits, packs cells to bytes, looks each cell up with
+         four byte shuffles over the 64 character table,
+         remaining values done by the scalar kernel
+Function input/parameters: batch cipher tables (const CipherBatchType *),
+                           encrypted values (const int []),
+                           number of values (int)
+Function output/parameters: decrypted characters (char [])
+Function output/returned: none
+Device input/file: none
+Device output/monitor: none
+Dependencies: SSSE3 intrinsics, cellsFromValuesSsse3, decryptValuesScalar
+*/
+__attribute__(( target( "ssse3" ) ))
+static void decryptValuesSsse3( const CipherBatchType *cipherBatch,
+                                const int values[], char chars[], int count )
+   {
+    // initialize variables
+       // function: _mm_set1_epi8
+    const __m128i lowMask = _mm_set1_epi8( 0x0F );
+    __m128i tableRows[ CELL_COUNT / NIBBLE_COUNT ];
+    __m128i first, second, cells, low, quarter, match, text;
+    const __m128i *source;
+    int index, row;
+
+    // load each 16 character quarter of the table
+    for( row = 0; row < CELL_COUNT / NIBBLE_COUNT; row++ )
+       {
+           // function: _mm_loadu_si128
+        tableRows[ row ] = _mm_loadu_si128(
+             (const __m128i *)&cipherBatch->cellChars[ row * NIBBLE_COUNT ] );
+       }
+
+    // loop across full vector steps
+    for( index = 0; index + SSSE3_STEP <= count; index += SSSE3_STEP )
+       {
+        source = (const __m128i *)&values[ index ];
+
+        // pack to 16 bits
+           // function: _mm_packs_epi32, _mm_loadu_si128
+        first = _mm_packs_epi32( _mm_loadu_si128( source ),
+                                 _mm_loadu_si128( source + 1 ) );
+        second = _mm_packs_epi32( _mm_loadu_si128( source + 2 ),
+                                  _mm_loadu_si128( source + 3 ) );
+
+        // split digits to cells, pack cells to bytes
+           // function: _mm_packus_epi16, cellsFromValuesSsse3
+        cells = _mm_packus_epi16( cellsFromValuesSsse3( first ),
+                                  cellsFromValuesSsse3( second ) );
+
+        // low nibble picks the character, high nibble picks the quarter
+           // function: _mm_and_si128, _mm_srli_epi16, _mm_setzero_si128
+        low = _mm_and_si128( cells, lowMask );
+        quarter = _mm_and_si128( _mm_srli_epi16( cells, 4 ), lowMask );
+        text = _mm_setzero_si128();
+
+        // keep each quarter's lookup where the quarter matches
+        for( row = 0; row < CELL_COUNT / NIBBLE_COUNT; row++ )
+           {
+               // function: _mm_cmpeq_epi8, _mm_set1_epi8, _mm_or_si128,
+               //           _mm_and_si128, _mm_shuffle_epi8
+            match = _mm_cmpeq_epi8( quarter, _mm_set1_epi8( (char)row ) );
+            text = _mm_or_si128( text, _mm_and_si128( match,
+                                  _mm_shuffle_epi8( tableRows[ row ], low ) ) );
+           }
+
+        // store characters
+           // function: _mm_storeu_si128
+        _mm_storeu_si128( (__m128i *)&chars[ index ], text );
+       }
+
+    // translate remaining values
+       // function: decryptValuesScalar
+    decryptValuesScalar( cipherBatch, values, chars, index, count );
+   }
+
+/*
+Name: encryptCharactersAvx2
+process: encrypts 32 characters per step: looks up the packed digits
+         with one in-lane byte shuffle per used high nibble,
+         widens them and adds the random digit times 100,
+         hands the rest to the scalar kernel at the end of input
+         or at a step holding a character not in the table
+Function input/parameters: batch cipher tables (const CipherBatchType *),
+                           characters to encrypt (const char []),
+                           random first digits (const unsigned char []),
+                           number of characters (int)
+Function output/parameters: encrypted values (int [])
+Function output/returned: index of first character not encrypted (int)
+Device input/file: none
+Device output/monitor: none
+Dependencies: AVX2 intrinsics, encryptCharactersScalar
+*/
+__attribute__(( target( "avx2" ) ))
+static int encryptCharactersAvx2( const CipherBatchType *cipherBatch,
+                   const char chars[], const unsigned char randDigits[],
+                                                   int values[], int count )
+   {
+    // initialize variables
+       // function: _mm256_set1_epi8, _mm256_set1_epi16
+    const __m256i lowMask = _mm256_set1_epi8( 0x0F );
+    const __m256i noCell = _mm256_set1_epi8( (char)NO_CELL );
+    const __m256i hundred = _mm256_set1_epi16( HUNDREDS_MULTIPLIER );
+    __m256i nibbleRows[ NIBBLE_COUNT ], nibbleKeys[ NIBBLE_COUNT ];
+    __m256i text, low, high, packed, match, half;
+    __m128i digits;
+    __m256i *target;
+    int index, nibble, side;
+
+    // broadcast each used packed digits row and its high nibble
+    for( nibble = 0; nibble < cipherBatch->highNibbleCount; nibble++ )
+       {
+           // function: _mm256_broadcastsi128_si256, _mm_loadu_si128,
+           //           _mm256_set1_epi8
+        nibbleRows[ nibble ] = _mm256_broadcastsi128_si256( _mm_loadu_si128(
+               (const __m128i *)cipherBatch->packedCells[
+                                       cipherBatch->highNibbles[ nibble ] ] ) );
+        nibbleKeys[ nibble ] = _mm256_set1_epi8(
+                                  (char)cipherBatch->highNibbles[ nibble ] );
+       }
+
+    // loop across full vector steps
+    for( index = 0; index + AVX2_STEP <= count; index += AVX2_STEP )
+       {
+        // split characters to low and high nibbles
+           // function: _mm256_loadu_si256, _mm256_and_si256,
+           //           _mm256_srli_epi16
+        text = _mm256_loadu_si256( (const __m256i *)&chars[ index ] );
+        low = _mm256_and_si256( text, lowMask );
+        high = _mm256_and_si256( _mm256_srli_epi16( text, 4 ), lowMask );
+        packed = noCell;
+
+        // keep each row's lookup where the high nibble matches
+        for( nibble = 0; nibble < cipherBatch->highNibbleCount; nibble++ )
+           {
+               // function: _mm256_cmpeq_epi8, _mm256_blendv_epi8,
+               //           _mm256_shuffle_epi8
+            match = _mm256_cmpeq_epi8( high, nibbleKeys[ nibble ] );
+            packed = _mm256_blendv_epi8( packed,
+                   _mm256_shuffle_epi8( nibbleRows[ nibble ], low ), match );
+           }
+
+        // let the scalar kernel find the character not in the table
+           // function: _mm256_movemask_epi8, _mm256_cmpeq_epi8
+        if( _mm256_movemask_epi8( _mm256_cmpeq_epi8( packed, noCell ) ) != 0 )
+           {
+               // function: encryptCharactersScalar
+            return encryptCharactersScalar( cipherBatch, chars, randDigits,
+                                                       values, index, count );
+           }
+
+        target = (__m256i *)&values[ index ];
+
+        // widen each 16 character half, add random digits times 100
+        for( side = 0; side < 2; side++ )
+           {
+               // function: _mm_loadu_si128, _mm256_add_epi16,
+               //           _mm256_cvtepu8_epi16, _mm256_castsi256_si128,
+               //           _mm256_extracti128_si256, _mm256_mullo_epi16
+            digits = _mm_loadu_si128(
+                    (const __m128i *)&randDigits[ index + side * NIBBLE_COUNT ] );
+            half = _mm256_add_epi16( _mm256_cvtepu8_epi16( side == 0
+                       ? _mm256_castsi256_si128( packed )
+                       : _mm256_extracti128_si256( packed, 1 ) ),
+                 _mm256_mullo_epi16( _mm256_cvtepu8_epi16( digits ), hundred ) );
+
+            // widen to 32 bits, store values
+               // function: _mm256_storeu_si256, _mm256_cvtepu16_epi32,
+               //           _mm256_castsi256_si128, _mm256_extracti128_si256
+            _mm256_storeu_si256( target + side * 2,
+                   _mm256_cvtepu16_epi32( _mm256_castsi256_si128( half ) ) );
+            _mm256_storeu_si256( target + side * 2 + 1,
+                   _mm256_cvtepu16_epi32( _mm256_extracti128_si256( half, 1 ) ) );
+           }
+       }
+
+    // encrypt remaining characters
+       // function: encryptCharactersScalar
+    return encryptCharactersScalar( cipherBatch, chars, randDigits,
+                                                       values, index, count );
+   }
+
+/*
+Name: encryptCharactersSsse3
+process: encrypts 16 characters per step: looks up the packed digits
+         with one byte shuffle per used high nibble,
+         widens them and adds the random digit times 100,
+         hands the rest to the scalar kernel at the end of input
+         or at a step holding a character not in the table
+Function input/parameters: batch cipher tables (const CipherBatchType *),
+                           characters to encrypt (const char []),
+                           random first digits (const unsigned char []),
+                           number of characters (int)
+Function output/parameters: encrypted values (int [])
+Function output/returned: index of first character not encrypted (int)
+Device input/file: none
+Device output/monitor: none
+Dependencies: SSSE3 intrinsics, encryptCharactersScalar
+*/
+__attribute__(( target( "ssse3" ) ))
+static int encryptCharactersSsse3( const CipherBatchType *cipherBatch,
+                   const char chars[], const unsigned char randDigits[],
+                                                   int values[], int count )
+   {
+    // initialize variables
+       // function: _mm_set1_epi8, _mm_set1_epi16, _mm_setzero_si128
+    const __m128i lowMask = _mm_set1_epi8( 0x0F );
+    const __m128i noCell = _mm_set1_epi8( (char)NO_CELL );
+    const __m128i hundred = _mm_set1_epi16( HUNDREDS_MULTIPLIER );
+    const __m128i zero = _mm_setzero_si128();
+    __m128i nibbleRows[ NIBBLE_COUNT ], nibbleKeys[ NIBBLE_COUNT ];
+    __m128i text, low, high, packed, match, digits, half;
+    __m128i *target;
+    int index, nibble;
+
+    // load each used packed digits row and its high nibble
+    for( nibble = 0; nibble < cipherBatch->highNibbleCount; nibble++ )
+       {
+           // function: _mm_loadu_si128, _mm_set1_epi8
+        nibbleRows[ nibble ] = _mm_loadu_si128(
+               (const __m128i *)cipherBatch->packedCells[
+                                       cipherBatch->highNibbles[ nibble ] ] );
+        nibbleKeys[ nibble ] = _mm_set1_epi8(
+                                  (char)cipherBatch->highNibbles[ nibble ] );
+       }
+
+    // loop across full vector steps
+    for( index = 0; index + SSSE3_STEP <= count; index += SSSE3_STEP )
+       {
+        // split characters to low and high nibbles
+           // function: _mm_loadu_si128, _mm_and_si128, _mm_srli_epi16
+        text = _mm_loadu_si128( (const __m128i *)&chars[ index ] );
+        low = _mm_and_si128( text, lowMask );
+        high = _mm_and_si128( _mm_srli_epi16( text, 4 ), lowMask );
+        packed = noCell;
+
+        // keep each row's lookup where the high nibble matches
+        for( nibble = 0; nibble < cipherBatch->highNibbleCount; nibble++ )
+           {
+               // function: _mm_cmpeq_epi8, _mm_or_si128, _mm_andnot_si128,
+               //           _mm_and_si128, _mm_shuffle_epi8
+            match = _mm_cmpeq_epi8( high, nibbleKeys[ nibble ] );
+            packed = _mm_or_si128( _mm_andnot_si128( match, packed ),
+                 _mm_and_si128( match,
+                           _mm_shuffle_epi8( nibbleRows[ nibble ], low ) ) );
+           }
+
+        // let the scalar kernel find the character not in the table
+           // function: _mm_movemask_epi8, _mm_cmpeq_epi8
+        if( _mm_movemask_epi8( _mm_cmpeq_epi8( packed, noCell ) ) != 0 )
+           {
+               // function: encryptCharactersScalar
+            return encryptCharactersScalar( cipherBatch, chars, randDigits,
+                                                       values, index, count );
+           }
+
+        // load random digits
+           // function: _mm_loadu_si128
+        target = (__m128i *)&values[ index ];
+        digits = _mm_loadu_si128( (const __m128i *)&randDigits[ index ] );
+
+        // widen each 8 character half, add random digits times 100,
+        // widen to 32 bits, store values
+           // function: _mm_add_epi16, _mm_unpacklo_epi8, _mm_unpackhi_epi8,
+           //           _mm_mullo_epi16, _mm_storeu_si128,
+           //           _mm_unpacklo_epi16, _mm_unpackhi_epi16
+        half = _mm_add_epi16( _mm_unpacklo_epi8( packed, zero ),
+               _mm_mullo_epi16( _mm_unpacklo_epi8( digits, zero ), hundred ) );
+
+        _mm_storeu_si128( target, _mm_unpacklo_epi16( half, zero ) );
+        _mm_storeu_si128( target + 1, _mm_unpackhi_epi16( half, zero ) );
+
+        half = _mm_add_epi16( _mm_unpackhi_epi8( packed, zero ),
+               _mm_mullo_epi16( _mm_unpackhi_epi8( digits, zero ), hundred ) );
+
+        _mm_storeu_si128( target + 2, _mm_unpacklo_epi16( half, zero ) );
+        _mm_storeu_si128( target + 3, _mm_unpackhi_epi16( half, zero ) );
+       }
+
+    // encrypt remaining characters
+       // function: encryptCharactersScalar
+    return encryptCharactersScalar( cipherBatch, chars, randDigits,
+                                                       values, index, count );
+   }
+
+#endif   //  CIPHER_BATCH_X86
+
+/*
+Name: buildCipherBatch
+process: copies lookup table and builds its character to packed digits
+         tables, first match kept in column then row order
+         as the table scan did, selects the best kernel the CPU supports
+Function input/parameters: lookup table, CELL_COUNT characters
+                           in row-major order (const char [])
+Function output/parameters: batch cipher tables (CipherBatchType *)
+Function output/returned: none
+Device input/file: none
+Device output/monitor: none
+Dependencies: detectKernelLevel
+*/
+void buildCipherBatch( const char cellChars[], CipherBatchType *cipherBatch )
+   {
+    // initialize variables
+    int row, column, high;
+    unsigned char code;
+
+    // copy table, mark every character code as not in table
+       // function: memcpy, memset
+    memcpy( cipherBatch->cellChars, cellChars, CELL_COUNT );
+    memset( cipherBatch->packedCells, NO_CELL,
+                                          sizeof( cipherBatch->packedCells ) );
+
+    // loop across table in column then row order
+    for( column = 0; column < CELL_SIDE; column++ )
+       {
+        for( row = 0; row < CELL_SIDE; row++ )
+           {
+            code = (unsigned char)cellChars[ row * CELL_SIDE + column ];
+
+            // keep first match of character
+            if( cipherBatch->packedCells[ code >> 4 ][ code & 0x0F ]
+                                                                   == NO_CELL )
+               {
+                cipherBatch->packedCells[ code >> 4 ][ code & 0x0F ] =
+                             (unsigned char)( row * TENS_MULTIPLIER + column );
+               }
+           }
+       }
+
+    // list the high nibbles the vector kernels need to visit
+    cipherBatch->highNibbleCount = 0;
+
+    for( high = 0; high < NIBBLE_COUNT; high++ )
+       {
+        // find any character in high nibble row
+        for( column = 0; column < NIBBLE_COUNT
+                  && cipherBatch->packedCells[ high ][ column ] == NO_CELL;
+                                                                   column++ );
+
+        // check for character found
+        if( column < NIBBLE_COUNT )
+           {
+            // add high nibble to list
+            cipherBatch->highNibbles[ cipherBatch->highNibbleCount ] = high;
+
+            cipherBatch->highNibbleCount++;
+           }
+       }
+
+    // select kernel
+       // function: detectKernelLevel
+    cipherBatch->level = detectKernelLevel();
+   }
+
+/*
+Name: decryptValueBatch
+process: translates encrypted values to characters with the kernel
+         selected in the tables, values must have all three digits
+         within the lookup table, 0 to 7
+Function input/parameters: batch cipher tables (const CipherBatchType *),
+                           encrypted values (const int []),
+                           number of values (int)
+Function output/parameters: decrypted characters (char [])
+Function output/returned: none
+Device input/file: none
+Device output/monitor: none
+Dependencies: decryptValuesAvx2, decryptValuesSsse3, decryptValuesScalar
+*/
+void decryptValueBatch( const CipherBatchType *cipherBatch,
+                            const int values[], char chars[], int count )
+   {
+#ifdef CIPHER_BATCH_X86
+    // check for AVX2 kernel
+    if( cipherBatch->level == AVX2_KERNEL )
+       {
+        // translate values
+           // function: decryptValuesAvx2
+        decryptValuesAvx2( cipherBatch, values, chars, count );
+
+        return;
+       }
+
+    // check for SSSE3 kernel
+    if( cipherBatch->level == SSSE3_KERNEL )
+       {
+        // translate values
+           // function: decryptValuesSsse3
+        decryptValuesSsse3( cipherBatch, values, chars, count );
+
+        return;
+       }
+#endif
+
+    // translate values one at a time
+       // function: decryptValuesScalar
+    decryptValuesScalar( cipherBatch, values, chars, 0, count );
+   }
+
+/*
+Name: detectKernelLevel
+process: reports the widest kernel the running CPU supports
+Function input/parameters: none
+Function output/parameters: none
+Function output/returned: kernel level (KernelLevels)
+Device input/file: none
+Device output/monitor: none
+Dependencies: __builtin_cpu_supports
+*/
+KernelLevels detectKernelLevel()
+   {
+#ifdef CIPHER_BATCH_X86
+    // read CPU features
+       // function: __builtin_cpu_init
+    __builtin_cpu_init();
+
+    // check for AVX2, widest kernel first
+       // function: __builtin_cpu_supports
+    if( __builtin_cpu_supports( "avx2" ) )
+       {
+        return AVX2_KERNEL;
+       }
+
+    // check for SSSE3
+       // function: __builtin_cpu_supports
+    if( __builtin_cpu_supports( "ssse3" ) )
+       {
+        return SSSE3_KERNEL;
+       }
+#endif
+
+    // no vector kernel supported
+    return SCALAR_KERNEL;
+   }
+
+/*
+Name: encryptCharacterBatch
+process: encrypts characters with the kernel selected in the tables,
+         random digit of each value given by caller,
+         stops at first character not in the lookup table
+Function input/parameters: batch cipher tables (const CipherBatchType *),
+                           characters to encrypt (const char []),
+                           random first digits, 0 to 7
+                           (const unsigned char []),
+                           number of characters (int)
+Function output/parameters: encrypted values (int [])
+Function output/returned: number of characters encrypted, less than count
+                          if the next character is not in the table (int)
+Device input/file: none
+Device output/monitor: none
+Dependencies: encryptCharactersAvx2, encryptCharactersSsse3,
+              encryptCharactersScalar
+*/
+int encryptCharacterBatch( const CipherBatchType *cipherBatch,
+                   const char chars[], const unsigned char randDigits[],
+                                                   int values[], int count )
+   {
+#ifdef CIPHER_BATCH_X86
+    // check for AVX2 kernel
+    if( cipherBatch->level == AVX2_KERNEL )
+       {
+        // encrypt characters
+           // function: encryptCharactersAvx2
+        return encryptCharactersAvx2( cipherBatch, chars, randDigits,
+                                                               values, count );
+       }
+
+    // check for SSSE3 kernel
+    if( cipherBatch->level == SSSE3_KERNEL )
+       {
+        // encrypt characters
+           // function: encryptCharactersSsse3
+        return encryptCharactersSsse3( cipherBatch, chars, randDigits,
+                                                               values, count );
+       }
+#endif
+
+    // encrypt characters one at a time
+       // function: encryptCharactersScalar
+    return encryptCharactersScalar( cipherBatch, chars, randDigits,
+                                                            values, 0, count );
+   }
+
+/*
+Name: getKernelName
+process: gives display name of kernel level
+Function input/parameters: kernel level (KernelLevels)
+Function output/parameters: none
+Function output/returned: kernel name (const char *)
+Device input/file: none
+Device output/monitor: none
+Dependencies: none
+*/
+const char *getKernelName( KernelLevels level )
+   {
+    // check for AVX2 kernel
+    if( level == AVX2_KERNEL )
+       {
+        return "avx2";
+       }
+
+    // check for SSSE3 kernel
+    if( level == SSSE3_KERNEL )
+       {
+        return "ssse3";
+       }
+
+    // otherwise scalar kernel
+    return "scalar";
+   }
+
+/*
+Name: reportBatchSpeed
+process: encrypts and decrypts generated text of the given size
+         with every kernel the CPU supports, checks each result
+         against the scalar kernel, displays throughput in GB/s
+         of plain text, returns true if all kernels agreed,
+         size must be from 1 megabyte to the most an int count can hold
+Function input/parameters: batch cipher tables (const CipherBatchType *),
+                           plain text size in megabytes (int)
+Function output/parameters: none
+Function output/returned: agreement of all kernels (bool)
+Device input/file: none
+Device output/monitor: throughput table displayed
+Dependencies: malloc, seedRandomContext, getRandomBetween,
+              fillRandomDigits, encryptCharacterBatch, decryptValueBatch,
+              getSeconds, memcmp, printf, free
+*/
+bool reportBatchSpeed( const CipherBatchType *cipherBatch, int megabytes )
+   {
+    // initialize variables, a size past an int count allocates nothing
+    bool sized = megabytes > 0
+                  && (size_t)megabytes <= INT_MAX / BYTES_PER_MEGABYTE;
+    size_t byteCount = sized ? (size_t)megabytes * BYTES_PER_MEGABYTE : 0;
+    int count = (int)byteCount, index, repeat, encrypted = 0;
+    char *text = NULL, *decrypted = NULL, *expectedText = NULL;
+    unsigned char *randDigits = NULL;
+    int *values = NULL, *expectedValues = NULL;
+    CipherBatchType kernelBatch = *cipherBatch;
+    RandomContextType randomContext;
+    double start, encryptTime, decryptTime;
+    bool agreed = true, matched;
+    KernelLevels level;
+
+    // check for valid size
+    if( sized )
+       {
+        // allocate text, digits and values
+           // function: malloc
+        text = malloc( byteCount );
+        decrypted = malloc( byteCount );
+        expectedText = malloc( byteCount );
+        randDigits = malloc( byteCount );
+        values = malloc( byteCount * sizeof( int ) );
+        expectedValues = malloc( byteCount * sizeof( int ) );
+       }
+
+    // check for invalid size or failed allocation
+    if( !sized || text == NULL || decrypted == NULL
+              || expectedText == NULL || randDigits == NULL || values == NULL
+                                                || expectedValues == NULL )
+       {
+        // report error
+           // function: printf
+        printf( "ERROR: Benchmark needs a size from 1 to %d MB"
+                        " that fits memory\n",
+                                  (int)( INT_MAX / BYTES_PER_MEGABYTE ) );
+
+        agreed = false;
+       }
+
+    // otherwise, run kernels
+    else
+       {
+        // text drawn from the table so every character encrypts
+           // function: seedRandomContext, getRandomBetween
+        seedRandomContext( &randomContext, BENCHMARK_SEED );
+
+        for( index = 0; index < count; index++ )
+           {
+            text[ index ] = cipherBatch->cellChars[
+                     getRandomBetween( &randomContext, 0, CELL_COUNT - 1 ) ];
+           }
+
+        // get random digits
+           // function: fillRandomDigits
+        fillRandomDigits( &randomContext, randDigits, count );
+
+        // scalar results are the reference
+           // function: encryptCharacterBatch, decryptValueBatch
+        kernelBatch.level = SCALAR_KERNEL;
+
+        encryptCharacterBatch( &kernelBatch, text, randDigits,
+                                                       expectedValues, count );
+        decryptValueBatch( &kernelBatch, expectedValues, expectedText, count );
+
+        // display table title
+           // function: printf
+        printf( "\nBatch cipher kernels, %d MB of plain text, best of %d\n",
+                                                megabytes, BENCHMARK_REPEATS );
+        printf( "Kernel    Encrypt GB/s   Decrypt GB/s\n" );
+
+        // loop across kernels the CPU supports
+        for( level = SCALAR_KERNEL; level <= cipherBatch->level; level++ )
+           {
+            kernelBatch.level = level;
+            encryptTime = decryptTime = 0.0;
+
+            // keep best of repeated runs
+            for( repeat = 0; repeat < BENCHMARK_REPEATS; repeat++ )
+               {
+                // time encryption
+                   // function: getSeconds, encryptCharacterBatch
+                start = getSeconds();
+                encrypted = encryptCharacterBatch( &kernelBatch, text,
+                                                 randDigits, values, count );
+                start = getSeconds() - start;
+
+                if( repeat == 0 || start < encryptTime )
+                   {
+                    encryptTime = start;
+                   }
+
+                // time decryption
+                   // function: getSeconds, decryptValueBatch
+                start = getSeconds();
+                decryptValueBatch( &kernelBatch, values, decrypted, count );
+                start = getSeconds() - start;
+
+                if( repeat == 0 || start < decryptTime )
+                   {
+                    decryptTime = start;
+                   }
+               }
+
+            // compare with scalar results
+               // function: memcmp
+            matched = encrypted == count
+                && memcmp( values, expectedValues, byteCount * sizeof( int ) )
+                                                                          == 0
+                && memcmp( decrypted, expectedText, byteCount ) == 0;
+
+            agreed = agreed && matched;
+
+            // display kernel throughput
+               // function: printf, getKernelName
+            printf( "%-8s %14.2f %14.2f%s\n", getKernelName( level ),
+                    (double)byteCount / BYTES_PER_GIGABYTE / encryptTime,
+                    (double)byteCount / BYTES_PER_GIGABYTE / decryptTime,
+                    matched ? "" : "   MISMATCH" );
+           }
+       }
+
+    // release memory
+       // function: free
+    free( text );
+    free( decrypted );
+    free( expectedText );
+    free( randDigits );
+    free( values );
+    free( expectedValues );
+
+    // return kernel agreement
+    return agreed;
+   }
@@ -0,0 +1,147 @@
+#ifndef CIPHER_BATCH_UTILITY_H
+#define CIPHER_BATCH_UTILITY_H
+
+// header files
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// vector kernels are built for x86 with GCC style target attributes
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define CIPHER_BATCH_X86 1
+#endif
+
+// constants
+
+// lookup table cells, cells per side, nibble table width,
+// characters per vector step, marker for a character not in the table
+typedef enum { CELL_COUNT = 64, CELL_SIDE = 8, NIBBLE_COUNT = 16,
+               SSSE3_STEP = 16, AVX2_STEP = 32, NO_CELL = 0xFF } CipherTableData;
+
+// kernel levels, each needs the CPU extension in its name
+typedef enum { SCALAR_KERNEL, SSSE3_KERNEL, AVX2_KERNEL } KernelLevels;
+
+// digit multipliers and division by ten as a 16 bit multiply high,
+// exact for every encrypted value up to 777
+typedef enum { TENS_MULTIPLIER = 10, HUNDREDS_MULTIPLIER = 100,
+               DIVIDE_TEN_MULTIPLIER = 6554 } CipherDigitData;
+
+// data structures
+
+// batch cipher tables, built once from the lookup table:
+//    cellChars     - lookup table characters, row-major
+//    packedCells   - [high nibble][low nibble] of a character code gives
+//                    its packed row * 10 + column digits, or NO_CELL
+//    highNibbles   - high nibbles holding at least one table character,
+//                    the only packedCells rows the vector kernels visit
+//    level         - kernel used by the batch functions
+typedef struct
+   {
+    char cellChars[ CELL_COUNT ];
+    unsigned char packedCells[ NIBBLE_COUNT ][ NIBBLE_COUNT ];
+    int highNibbles[ NIBBLE_COUNT ];
+    int highNibbleCount;
+    KernelLevels level;
+   } CipherBatchType;
+
+// prototypes
+
+/*
+Name: buildCipherBatch
+process: copies lookup table and builds its character to packed digits
+         tables, first match kept in column then row order
+         as the table scan did, selects the best kernel the CPU supports
+Function input/parameters: lookup table, CELL_COUNT characters
+                           in row-major order (const char [])
+Function output/parameters: batch cipher tables (CipherBatchType *)
+Function output/returned: none
+Device input/file: none
+Device output/monitor: none
+Dependencies: detectKernelLevel
+*/
+void buildCipherBatch( const char cellChars[], CipherBatchType *cipherBatch );
+
+/*
+Name: decryptValueBatch
+process: translates encrypted values to characters with the kernel
+         selected in the tables, values must have all three digits
+         within the lookup table, 0 to 7
+Function input/parameters: batch cipher tables (const CipherBatchType *),
+                           encrypted values (const int []),
+                           number of values (int)
+Function output/parameters: decrypted characters (char [])
+Function output/returned: none
+Device input/file: none
+Device output/monitor: none
+Dependencies: decryptValuesAvx2, decryptValuesSsse3, decryptValuesScalar
+*/
+void decryptValueBatch( const CipherBatchType *cipherBatch,
+                            const int values[], char chars[], int count );
+
+/*
+Name: detectKernelLevel
+process: reports the widest kernel the running CPU supports
+Function input/parameters: none
+Function output/parameters: none
+Function output/returned: kernel level (KernelLevels)
+Device input/file: none
+Device output/monitor: none
+Dependencies: __builtin_cpu_supports
+*/
+KernelLevels detectKernelLevel();
+
+/*
+Name: encryptCharacterBatch
+process: encrypts characters with the kernel selected in the tables,
+         random digit of each value given by caller,
+         stops at first character not in the lookup table
+Function input/parameters: batch cipher tables (const CipherBatchType *),
+                           characters to encrypt (const char []),
+                           random first digits, 0 to 7
+                           (const unsigned char []),
+                           number of characters (int)
+Function output/parameters: encrypted values (int [])
+Function output/returned: number of characters encrypted, less than count
+                          if the next character is not in the table (int)
+Device input/file: none
+Device output/monitor: none
+Dependencies: encryptCharactersAvx2, encryptCharactersSsse3,
+              encryptCharactersScalar
+*/
+int encryptCharacterBatch( const CipherBatchType *cipherBatch,
+                   const char chars[], const unsigned char randDigits[],
+                                                   int values[], int count );
+
+/*
+Name: getKernelName
+process: gives display name of kernel level
+Function input/parameters: kernel level (KernelLevels)
+Function output/parameters: none
+Function output/returned: kernel name (const char *)
+Device input/file: none
+Device output/monitor: none
+Dependencies: none
+*/
+const char *getKernelName( KernelLevels level );
+
+/*
+Name: reportBatchSpeed
+process: encrypts and decrypts generated text of the given size
+         with every kernel the CPU supports, checks each result
+         against the scalar kernel, displays throughput in GB/s
+         of plain text, returns true if all kernels agreed
+Function input/parameters: batch cipher tables (const CipherBatchType *),
+                           plain text size in megabytes (int)
+Function output/parameters: none
+Function output/returned: agreement of all kernels (bool)
+Device input/file: none
+Device output/monitor: throughput table displayed
+Dependencies: malloc, seedRandomContext, getRandomBetween,
+              fillRandomDigits, encryptCharacterBatch, decryptValueBatch,
+              getSeconds, memcmp, printf, free
+*/
+bool reportBatchSpeed( const CipherBatchType *cipherBatch, int megabytes );
+
+#endif   //  CIPHER_BATCH_UTILITY_H
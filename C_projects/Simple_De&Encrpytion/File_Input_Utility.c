@@ -7,10 +7,30 @@ Code is free for use in whole or in part and may be modified for other
 non-commercial use as long as the above copyright statement is included.
 */
 
+// POSIX declarations for file mapping, set before any system header
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 // header files
 #include "File_Input_Utility.h"
+#include <ctype.h>
+#include <stdint.h>
+#include <string.h>
 #include <stdlib.h> //////////////////////////test
 
+// file mapping only where the platform provides it,
+// otherwise every file is read through the stdio block buffer
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <unistd.h>
+#endif
+
+#if defined( _POSIX_MAPPED_FILES ) && _POSIX_MAPPED_FILES > 0
+#define INPUT_FILE_MAPPING
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 // local global constants, used only in this file
 
     // dummy file pointer for accessInputFilePointer
@@ -33,38 +53,212 @@ non-commercial use as long as the above copyright statement is included.
     //   accessOpenFlag
     const int SET_INPUT_FLAG = 1001;
 
+// data structures, opaque outside this file
+
+    // input reader state: file pointer, end of file flag, 
+    // and buffer or mapped span the readers parse from
+    struct InputReaderStruct
+       {
+        FILE *filePtr;
+        bool endOfFile;
+        InputBufferType buffer;
+       };
+
+
+    /*
+    Name: clearBufferWhiteSpace
+    process: captures non printable characters through the given buffer,
+             and space if flag set,
+             returns first non white space value found as integer
+    Function input/parameters: pointer to input buffer (InputBufferType *),
+                               file pointer (FILE *), clear space flag (bool)
+    Function output/parameters: pointer to input buffer (InputBufferType *)
+    Function output/returned: first non WS character as integer
+    Device input/file: value captured from file
+    Device output/monitor: none
+    Dependencies: getInputChar
+    */
+    static int clearBufferWhiteSpace( InputBufferType *inputBuffer, 
+                                            FILE *filePtr, bool clearSpace )
+       {
+        // initialize character input value
+           // function: getInputChar
+        int charInt = getInputChar( inputBuffer, filePtr );
+
+        while( 
+        // continue if not at end of file
+        ( charInt != EOF )
+
+        // AND
+        // continue if character is non printable
+        && ( ( charInt < SPACE )
+
+        // OR
+        // continue if clear space flag set and space is found
+        || ( clearSpace && charInt == SPACE ) )
+             )
+           {
+            // capture next character
+               // function: getInputChar
+            charInt = getInputChar( inputBuffer, filePtr );
+           }
+
+        // return input value as character
+        return (char)charInt;
+       }
+
+    /*
+    Name: closeReaderFile
+    process: releases reader buffer, closes reader file, 
+             unsets end of file flag,
+             returns true if successful, false otherwise
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: input reader (InputReaderType *)
+    Function output/returned: success of operation (bool)
+    Device input/file: file closed
+    Device output/monitor: none
+    Dependencies: resetInputBuffer, fclose
+    */
+    static bool closeReaderFile( InputReaderType *reader )
+       {
+        // check for valid file pointer
+        if( reader->filePtr != NULL )
+           {
+            // release mapped span, discard unread buffered data
+               // function: resetInputBuffer
+            resetInputBuffer( &reader->buffer );
+
+            // close file
+            fclose( reader->filePtr );
+
+            // set pointer to NULL, end of file flag to false
+            reader->filePtr = NULL;
+            reader->endOfFile = false;
+
+            // return successful operation
+            return true;
+           }
+
+        // return failed operation
+        return false;
+       }
+
+    /*
+    Name: openReaderFile
+    process: opens file for reader, unsets end of file flag,
+             maps large regular files into memory for reading,
+             returns true if successful, false otherwise
+    Function input/parameters: input reader (InputReaderType *), 
+                               file name (c-string)
+    Function output/parameters: input reader (InputReaderType *)
+    Function output/returned: success of operation (bool)
+    Device input/file: file opened
+    Device output/monitor: none
+    Dependencies: fopen, resetInputBuffer, mapInputFile
+    */
+    static bool openReaderFile( InputReaderType *reader, const char *fileName )
+       {
+        // initialize variables
+        char readOnlyCharacter[] = "r";
+
+        // open file
+           // function: fopen
+        FILE *filePtr = fopen( fileName, readOnlyCharacter );
+
+        // check for success of file open
+        if( filePtr != NULL )
+           {
+            // set reader file, reset end of file flag
+            reader->filePtr = filePtr;
+            reader->endOfFile = false;
+
+            // start with empty buffer, map file when large enough
+               // function: resetInputBuffer, mapInputFile
+            resetInputBuffer( &reader->buffer );
+
+            mapInputFile( &reader->buffer, filePtr );
+
+            // return operation success
+            return true;
+           }
+
+        // return operation failure
+        return false;
+       }
+
+    /*
+    Name: accessDefaultInputReader
+    process: allows access to the input reader used by the 
+             global-style functions (openInputFile, readIntegerFromFile, etc.);
+             note: reader is maintained (static) value initialized closed
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: pointer to default reader (InputReaderType *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    InputReaderType *accessDefaultInputReader()
+       {
+        // initialize reader to closed, empty buffer
+        static InputReaderType defaultReader 
+                                  = { NULL, false, { { 0 }, NULL, 0, 0, 0 } };
+
+        // return reader
+        return &defaultReader;
+       }
 
     /*
     Name: accessEndOfInputFileFlag
     process: allows accessing or modifying end of file flag state;
-             note: flag is maintained (static) value initialized to false
+             note: flag is kept in default input reader, initialized to false
     Function input/parameters: control code (int), flag state (bool)
     Function output/parameters: none
     Function output/returned: result of flag state (bool)
     Device input/file: none
     Device output/monitor: none
-    Dependencies: none
+    Dependencies: accessDefaultInputReader
     */
     bool accessEndOfInputFileFlag( int ctrlCode, bool setFlag )
        {
-        // initialize end of file flag to false
-        static bool endOfFileFlag = false;
+        // initialize variables
+           // function: accessDefaultInputReader
+        InputReaderType *reader = accessDefaultInputReader();
 
         // test for set flag
         if( ctrlCode == SET_INPUT_FLAG )
            {
             // set flag to given state
-            endOfFileFlag = setFlag;
+            reader->endOfFile = setFlag;
            }
     
         // return flag state
-        return endOfFileFlag;
+        return reader->endOfFile;
+       }
+
+    /*
+    Name: accessInputBuffer
+    process: allows access to the block buffer or mapped file span 
+             between file and readers;
+             note: buffer is kept in default input reader, initialized empty
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: pointer to input buffer (InputBufferType *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: accessDefaultInputReader
+    */
+    InputBufferType *accessInputBuffer()
+       {
+        // return default reader buffer
+           // function: accessDefaultInputReader
+        return &accessDefaultInputReader()->buffer;
        }
 
     /*
     Name: accessInputFilePointer
     process: allows setting or accessing file pointer;
-             note: pointer is maintained (static) value initialized to NULL
+             note: pointer is kept in default input reader, initialized to NULL
     Function input/parameters: control code (int), file pointer (FILE *)
                                DUMMY_INPUT_FILE_PTR used 
                                if not setting file pointer
@@ -72,22 +266,23 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: file pointer (FILE *)
     Device input/file: none
     Device output/monitor: none
-    Dependencies: none
+    Dependencies: accessDefaultInputReader
     */
     FILE *accessInputFilePointer( int ctrlCode, const FILE *filePtr )
        {
-        // initialize file pointer to null
-        static FILE *filePointer = NULL;
+        // initialize variables
+           // function: accessDefaultInputReader
+        InputReaderType *reader = accessDefaultInputReader();
 
         // check for set new pointer
         if( ctrlCode == SET_INPUT_FILE_PTR )
            {
             // set file pointer to parameter
-            filePointer = (FILE *)filePtr;
+            reader->filePtr = (FILE *)filePtr;
            }
  
         // return file pointer
-        return filePointer;
+        return reader->filePtr;
        }
 
     /*
@@ -127,6 +322,41 @@ non-commercial use as long as the above copyright statement is included.
                                                  DUMMY_INPUT_FILE_PTR ) != NULL;
        }
 
+    /*
+    Name: checkForReaderEndOfFile
+    process: checks to see if reader end of file flag has been encountered,
+             returns true if EOF has been encountered, false otherwise
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForReaderEndOfFile( const InputReaderType *reader )
+       {
+        // return reader end of file flag
+        return reader->endOfFile;
+       }
+
+    /*
+    Name: checkForReaderOpen
+    process: checks to see if reader file is currently open
+             returns true if reader and its file pointer not null, 
+             false otherwise
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForReaderOpen( const InputReaderType *reader )
+       {
+        // return reader file state
+        return reader != NULL && reader->filePtr != NULL;
+       }
+
     /*
     Name: clearLeadingWhiteSpace
     process: captures non printable characters,
@@ -137,34 +367,14 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: first non WS character as integer
     Device input/file: value captured from file
     Device output/monitor: none
-    Dependencies: fgetc
+    Dependencies: accessInputBuffer, clearBufferWhiteSpace
     */
     int clearLeadingWhiteSpace( FILE *filePtr, bool clearSpace )
        {
-        // initialize character input value
-           // function: fgetc
-        int charInt = fgetc( filePtr );
-
-        while( 
-        // continue if not at end of file
-        ( charInt != EOF )
-
-        // AND
-        // continue if character is non printable
-        && ( ( charInt < SPACE )
-
-        // OR
-        // continue if clear space flag set and space is found
-        || ( clearSpace && charInt == SPACE ) )
-             )
-           {
-            // capture next character
-               // function: fgetc
-            charInt = fgetc( filePtr );
-           }
-
-        // return input value as character
-        return (char)charInt;
+        // clear through default reader buffer, return
+           // function: accessInputBuffer, clearBufferWhiteSpace
+        return clearBufferWhiteSpace( accessInputBuffer(), 
+                                                       filePtr, clearSpace );
        }
 
     /*
@@ -175,83 +385,333 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: none
     Device input/file: file closed
     Device output/monitor: none
-    Dependencies: accessInputFilePointer, fclose, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, closeReaderFile
     */
     bool closeInputFile()
        {
-        // set local file pointer to working file pointer
-           // function: accessInputFilePointer
-        FILE *filePtr = accessInputFilePointer( GET_INPUT_FILE_PTR, 
-                                                         DUMMY_INPUT_FILE_PTR );
+        // close default reader file, return
+           // function: accessDefaultInputReader, closeReaderFile
+        return closeReaderFile( accessDefaultInputReader() );
+       }
 
-        // check for valid file pointer
-        if( filePtr != NULL )
+    /*
+    Name: closeInputReader
+    process: closes reader file if open, releases reader memory,
+             returns true if a file was closed, false otherwise
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: file closed
+    Device output/monitor: none
+    Dependencies: closeReaderFile, free
+    */
+    bool closeInputReader( InputReaderType *reader )
+       {
+        // initialize variables
+        bool closed = false;
+
+        // check for valid reader
+        if( reader != NULL )
            {
-            // close file
-            fclose( filePtr );
+            // close file, release reader
+               // function: closeReaderFile, free
+            closed = closeReaderFile( reader );
 
-            // set pointer to NULL
-               // function: accessInputFilePointer
-            accessInputFilePointer( SET_INPUT_FILE_PTR, NULL );
+            free( reader );
+           }
 
-            // set end of file flag to false
-               // function: accessEndOfInputFileFlag
-            accessEndOfInputFileFlag( SET_INPUT_FLAG, false );
+        // return operation result
+        return closed;
+       }
 
-            // return successful operation
-            return true;
-           }  
+    /*
+    Name: fillInputBuffer
+    process: moves unread bytes to the front of the buffer,
+             then reads a block from the file to fill the rest,
+             returns number of unread bytes now in the buffer, 
+             zero at end of file;
+             a mapped file span already holds the whole file, 
+             so nothing is read for it
+    Function input/parameters: pointer to input buffer (InputBufferType *),
+                               file pointer (FILE *)
+    Function output/parameters: pointer to input buffer (InputBufferType *)
+    Function output/returned: unread byte count (size_t)
+    Device input/file: block captured from file
+    Device output/monitor: none
+    Dependencies: memmove, fread
+    */
+    size_t fillInputBuffer( InputBufferType *inputBuffer, FILE *filePtr )
+       {
+        // initialize variables
+        size_t unreadCount = inputBuffer->length - inputBuffer->position;
+
+        // check for mapped span
+        if( inputBuffer->mapLength > 0 )
+           {
+            // return unread count, nothing more to read
+            return unreadCount;
+           }
+
+        // keep unread bytes
+           // function: memmove
+        memmove( inputBuffer->data, 
+                      &inputBuffer->data[ inputBuffer->position ], unreadCount );
+
+        inputBuffer->bytes = inputBuffer->data;
+        inputBuffer->position = 0;
+        inputBuffer->length = unreadCount;
+
+        // read block into remaining space
+           // function: fread
+        inputBuffer->length += fread( &inputBuffer->data[ unreadCount ],
+                          1, INPUT_BUFFER_SIZE - unreadCount, filePtr );
+
+        // return unread count
+        return inputBuffer->length;
+       }
+
+    /*
+    Name: getInputChar
+    process: captures next byte through the input buffer,
+             refilling buffer from file when empty
+    Function input/parameters: pointer to input buffer (InputBufferType *),
+                               file pointer (FILE *)
+    Function output/parameters: pointer to input buffer (InputBufferType *)
+    Function output/returned: byte as unsigned char value, EOF at end of file
+    Device input/file: block captured from file as needed
+    Device output/monitor: none
+    Dependencies: fillInputBuffer
+    */
+    int getInputChar( InputBufferType *inputBuffer, FILE *filePtr )
+       {
+        // check for empty buffer and nothing left to read
+           // function: fillInputBuffer
+        if( inputBuffer->position == inputBuffer->length 
+                             && fillInputBuffer( inputBuffer, filePtr ) == 0 )
+           {
+            // return end of file
+            return EOF;
+           }
+
+        // return byte, move past it
+        return (unsigned char)inputBuffer->bytes[ inputBuffer->position++ ];
+       }
+
+    /*
+    Name: getInputFileSpan
+    process: provides the unread part of a memory mapped input file 
+             as a read-only byte span, without copying;
+             returns NULL with zero length when the file is read 
+             through stdio (no file open, small file, or pipe)
+    Function input/parameters: none
+    Function output/parameters: span length in bytes (size_t *)
+    Function output/returned: pointer to first unread byte (const char *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: accessDefaultInputReader, getReaderSpan
+    */
+    const char *getInputFileSpan( size_t *spanLength )
+       {
+        // get span of default reader, return
+           // function: accessDefaultInputReader, getReaderSpan
+        return getReaderSpan( accessDefaultInputReader(), spanLength );
+       }
+
+    /*
+    Name: getReaderSpan
+    process: provides the unread part of a reader memory mapped file 
+             as a read-only byte span, without copying;
+             returns NULL with zero length when the file is read 
+             through stdio (no file open, small file, or pipe)
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: span length in bytes (size_t *)
+    Function output/returned: pointer to first unread byte (const char *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    const char *getReaderSpan( const InputReaderType *reader, 
+                                                         size_t *spanLength )
+       {
+        // initialize variables
+        const InputBufferType *inputBuffer = &reader->buffer;
+
+        // check for mapped span
+        if( inputBuffer->mapLength > 0 )
+           {
+            // set unread length, return first unread byte
+            *spanLength = inputBuffer->length - inputBuffer->position;
+
+            return &inputBuffer->bytes[ inputBuffer->position ];
+           }
+
+        // set empty span
+        *spanLength = 0;
+
+        return NULL;
+       }
+
+    /*
+    Name: mapInputFile
+    process: maps a newly opened regular file into memory as 
+             the read-only span behind the input buffer,
+             leaves the buffer reading through stdio for small files, 
+             pipes and other non regular files, if mapping fails,
+             or on platforms without POSIX file mapping,
+             returns true if file mapped, false otherwise
+    Function input/parameters: pointer to input buffer (InputBufferType *),
+                               file pointer (FILE *)
+    Function output/parameters: pointer to input buffer (InputBufferType *)
+    Function output/returned: success of mapping (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: fileno, fstat, mmap, posix_madvise
+    */
+    bool mapInputFile( InputBufferType *inputBuffer, FILE *filePtr )
+       {
+#ifdef INPUT_FILE_MAPPING
+        // initialize variables
+        int fileDescriptor = fileno( filePtr );
+        struct stat fileStats;
+        void *span;
+
+        // check for large enough regular file
+           // function: fstat
+        if( fstat( fileDescriptor, &fileStats ) == 0 
+                && S_ISREG( fileStats.st_mode )
+                && fileStats.st_size >= MIN_MAPPED_FILE_SIZE
+                && (unsigned long long)fileStats.st_size <= SIZE_MAX )
+           {
+            // map whole file read-only
+               // function: mmap
+            span = mmap( NULL, (size_t)fileStats.st_size, PROT_READ, 
+                                            MAP_PRIVATE, fileDescriptor, 0 );
+
+            // check for success
+            if( span != MAP_FAILED )
+               {
+                // readers move front to back
+                   // function: posix_madvise
+                posix_madvise( span, (size_t)fileStats.st_size, 
+                                                  POSIX_MADV_SEQUENTIAL );
+
+                // set span as buffer bytes
+                inputBuffer->bytes = span;
+                inputBuffer->position = 0;
+                inputBuffer->length = (size_t)fileStats.st_size;
+                inputBuffer->mapLength = inputBuffer->length;
+
+                return true;
+               }
+           }
+#else
+        // no mapping on this platform
+        (void)inputBuffer;
+        (void)filePtr;
+#endif
 
-        // return failed  operation
+        // leave file to stdio
         return false;
        }
 
    /*
     Name: openInputFile
     process: opens input file, sets file pointer and unsets end of file flag,
+             maps large regular files into memory for reading,
              returns true if successful, false otherwise
     Function input/parameters: file name (c-string)
     Function output/parameters: none
     Function output/returned: success of operation (bool)
     Device input/file: file opened
     Device output/monitor: none
-    Dependencies: fopen, accessInputFilePointer, accessEndOfInputFileFlag
+    Dependencies: checkForInputFileOpen, accessDefaultInputReader, 
+                  openReaderFile
     */
     bool openInputFile( const char *fileName )
        {
-        // initialize variables
-        FILE *filePtr = NULL;
-        char readOnlyCharacter[] = "r";
-
         // check for file not open
            // function: checkForInputFileOpen
         if( !checkForInputFileOpen() )
            {
-            // open file
-               // function: fopen
-            filePtr = fopen( fileName, readOnlyCharacter );
+            // open file in default reader, return
+               // function: accessDefaultInputReader, openReaderFile
+            return openReaderFile( accessDefaultInputReader(), fileName );
+           }
 
-            // check for success of file open
-            if( filePtr != NULL )
-               {
-                // set pointer in access function
-                   // function: accessInputFilePointer
-                accessInputFilePointer( SET_INPUT_FILE_PTR, filePtr );
+        // return operation failure
+        return false;
+       }
+    
+    /*
+    Name: openInputReader
+    process: creates an independent input reader and opens the file in it;
+             readers share no state, so each may be used on its own thread,
+             returns reader if successful, NULL otherwise
+    Function input/parameters: file name (c-string)
+    Function output/parameters: none
+    Function output/returned: new reader (InputReaderType *), 
+                              release with closeInputReader
+    Device input/file: file opened
+    Device output/monitor: none
+    Dependencies: malloc, openReaderFile, free
+    */
+    InputReaderType *openInputReader( const char *fileName )
+       {
+        // create reader
+           // function: malloc
+        InputReaderType *reader = malloc( sizeof( InputReaderType ) );
 
-                // reset end of file flag, if needed
-                   // accessEndOfInputFileFlag
-                accessEndOfInputFileFlag( SET_INPUT_FLAG, false );
+        // check for allocated reader
+        if( reader != NULL )
+           {
+            // set empty state, nothing mapped
+            reader->filePtr = NULL;
+            reader->endOfFile = false;
+            reader->buffer.mapLength = 0;
+
+            // open file, check for failure
+               // function: openReaderFile
+            if( !openReaderFile( reader, fileName ) )
+               {
+                // release reader
+                   // function: free
+                free( reader );
 
-                // return operation success
-                return true;
+                reader = NULL;
                }
            }
-        // end of file not previously opened block
 
-        // return operation failure
-        return false;
+        // return reader
+        return reader;
        }
-    
+
+    /*
+    Name: peekInputChar
+    process: returns next byte through the input buffer without consuming it,
+             refilling buffer from file when empty
+    Function input/parameters: pointer to input buffer (InputBufferType *),
+                               file pointer (FILE *)
+    Function output/parameters: pointer to input buffer (InputBufferType *)
+    Function output/returned: byte as unsigned char value, EOF at end of file
+    Device input/file: block captured from file as needed
+    Device output/monitor: none
+    Dependencies: fillInputBuffer
+    */
+    int peekInputChar( InputBufferType *inputBuffer, FILE *filePtr )
+       {
+        // check for empty buffer and nothing left to read
+           // function: fillInputBuffer
+        if( inputBuffer->position == inputBuffer->length 
+                             && fillInputBuffer( inputBuffer, filePtr ) == 0 )
+           {
+            // return end of file
+            return EOF;
+           }
+
+        // return byte, leave it unread
+        return (unsigned char)inputBuffer->bytes[ inputBuffer->position ];
+       }
+
     /*
     Name: readCharacterFromFile
     process: ignores leading unprintable characters, including space,
@@ -283,35 +743,72 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: character found if successful, ZERO_CHAR otherwise
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, clearLeadingWhiteSpace, 
-                  accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readCharacterFromReaderConfigured
     */
     char readCharacterFromFileConfigured( bool captureSpace )
+       {
+        // read through default input reader, return
+           // function: accessDefaultInputReader, 
+           //           readCharacterFromReaderConfigured
+        return readCharacterFromReaderConfigured( accessDefaultInputReader(), 
+                                                                captureSpace );
+       }
+
+    /*
+    Name: readCharacterFromReader
+    process: ignores leading unprintable characters, including space,
+             captures first printable character
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: character found if successful, ZERO_CHAR otherwise
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readCharacterFromReaderConfigured
+    */
+    char readCharacterFromReader( InputReaderType *reader )
+       {
+        // initialize parameter to not allow space
+        bool noSpaceCapture = false;
+
+        // capture character, return
+           // function: readCharacterFromReaderConfigured
+        return readCharacterFromReaderConfigured( reader, noSpaceCapture );
+       }
+
+    /*
+    Name: readCharacterFromReaderConfigured
+    process: ignores leading unprintable characters,
+             captures first printable character,
+             including space if allowed
+    Function input/parameters: input reader (InputReaderType *),
+                               allow space capture (bool)
+    Function output/parameters: none
+    Function output/returned: character found if successful, ZERO_CHAR otherwise
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForReaderOpen, checkForReaderEndOfFile, 
+                  clearBufferWhiteSpace
+    */
+    char readCharacterFromReaderConfigured( InputReaderType *reader, 
+                                                           bool captureSpace )
        {
         // initialize variables
-        FILE *filePtr;
         int intChar = ZERO_CHAR;
 
         // check for file open and data accessible
-           // function: checkForInputFileOpen, checkForEndOfInputFile
-        if( checkForInputFileOpen() && !checkForEndOfInputFile() )
+           // function: checkForReaderOpen, checkForReaderEndOfFile
+        if( checkForReaderOpen( reader ) && !checkForReaderEndOfFile( reader ) )
            {
-            // set file pointer
-               // function: accessInputFilePointer
-            filePtr = accessInputFilePointer( GET_INPUT_FILE_PTR, 
-                                                         DUMMY_INPUT_FILE_PTR );
-
             // get character
-               // function: clearLeadingWhiteSpace
-            intChar = clearLeadingWhiteSpace( filePtr, !captureSpace );
+               // function: clearBufferWhiteSpace
+            intChar = clearBufferWhiteSpace( &reader->buffer, 
+                                            reader->filePtr, !captureSpace );
 
             // check for end of file found
             if( intChar == EOF )
                {
                 // set end of file flag
-                   // function: accessEndOfInputFileFlag
-                accessEndOfInputFileFlag( SET_INPUT_FLAG, true );
+                reader->endOfFile = true;
 
                 // set return value to zero
                 intChar = ZERO_CHAR;
@@ -331,35 +828,47 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: double value found if successful (double)
     Device input/file: double value captured from file
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fscanf, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readDoubleFromReader
     */
     double readDoubleFromFile()
+       {
+        // read through default input reader, return
+           // function: accessDefaultInputReader, readDoubleFromReader
+        return readDoubleFromReader( accessDefaultInputReader() );
+       }
+
+    /*
+    Name: readDoubleFromReader
+    process: ignores leading unprintable characters,
+             captures first contiguous double value
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: double value found if successful (double)
+    Device input/file: double value captured from file
+    Device output/monitor: none
+    Dependencies: checkForReaderOpen, checkForReaderEndOfFile, 
+                  scanDoubleFromInput
+    */
+    double readDoubleFromReader( InputReaderType *reader )
        {
         // initialize variables
-        FILE *filePtr = NULL;
         int fscanfReturn = EOF;
         double doubleVal = ZERO_VALUE;
 
         // check for file open and data accessible
-           // function: checkForInputFileOpen, checkForEndOfInputFile
-        if( checkForInputFileOpen() && !checkForEndOfInputFile() )
+           // function: checkForReaderOpen, checkForReaderEndOfFile
+        if( checkForReaderOpen( reader ) && !checkForReaderEndOfFile( reader ) )
            {
-            // set file pointer
-               // function: accessInputFilePointer
-            filePtr = accessInputFilePointer( GET_INPUT_FILE_PTR, 
-                                                         DUMMY_INPUT_FILE_PTR );
-
             // get double value
-               // function: fscanf
-            fscanfReturn = fscanf( filePtr, "%lf", &doubleVal );
+               // function: scanDoubleFromInput
+            fscanfReturn = scanDoubleFromInput( &reader->buffer, 
+                                                reader->filePtr, &doubleVal );
 
             // check for end of file found
             if( fscanfReturn == EOF )
                {
                 // set end of file flag
-                   // function: accessEndOfInputFileFlag
-                accessEndOfInputFileFlag( SET_INPUT_FLAG, true );
+                reader->endOfFile = true;
 
                 // set return value to zero
                 doubleVal = ZERO_VALUE;
@@ -379,35 +888,55 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: integer found if successful, ZERO_VALUE otherwise
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fscanf, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readIntegerFromReader
     */
     int readIntegerFromFile()
+       {
+        // read through default input reader, return
+           // function: accessDefaultInputReader, readIntegerFromReader
+        return readIntegerFromReader( accessDefaultInputReader() );
+       }
+
+    /*
+    Name: readIntegerFromReader
+    process: ignores leading unprintable characters,
+             captures first contiguous integer
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: integer found if successful, ZERO_VALUE otherwise
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForReaderOpen, checkForReaderEndOfFile, 
+                  scanLongFromInput
+    */
+    int readIntegerFromReader( InputReaderType *reader )
        {
         // initialize variables
-        FILE *filePtr = NULL;
         int fscanfReturn = EOF;
         int intVal = ZERO_VALUE;
+        long longVal = ZERO_VALUE;
 
         // check for file open and data accessible
-           // function: checkForInputFileOpen, checkForEndOfInputFile
-        if( checkForInputFileOpen() && !checkForEndOfInputFile() )
+           // function: checkForReaderOpen, checkForReaderEndOfFile
+        if( checkForReaderOpen( reader ) && !checkForReaderEndOfFile( reader ) )
            {
-            // set file pointer
-               // function: accessInputFilePointer
-            filePtr = accessInputFilePointer( GET_INPUT_FILE_PTR, 
-                                                         DUMMY_INPUT_FILE_PTR );
-
             // get integer value
-               // function: fscanf
-            fscanfReturn = fscanf( filePtr, "%d", &intVal );
+               // function: scanLongFromInput
+            fscanfReturn = scanLongFromInput( &reader->buffer, 
+                                                  reader->filePtr, &longVal );
+
+            // check for value found
+            if( fscanfReturn == 1 )
+               {
+                // set return value
+                intVal = (int)longVal;
+               }
 
             // check for end of file found
             if( fscanfReturn == EOF )
                {
                 // set end of file flag
-                   // function: accessEndOfInputFileFlag
-                accessEndOfInputFileFlag( SET_INPUT_FLAG, true );
+                reader->endOfFile = true;
 
                 // set return value to zero
                 intVal = ZERO_VALUE;
@@ -418,6 +947,87 @@ non-commercial use as long as the above copyright statement is included.
         return intVal;
        }
       
+    /*
+    Name: readIntegersFromFile
+    process: ignores leading white space before each value,
+             captures up to the given number of contiguous integers 
+             into the array in one call, parsed straight from the input 
+             buffer; stops early at end of file, setting the end of file 
+             flag as readIntegerFromFile does, or at text that is not 
+             an integer, leaving it unread
+    Function input/parameters: number of values wanted (int)
+    Function output/parameters: values captured (int *)
+    Function output/returned: number of values captured (int)
+    Device input/file: values captured from file as needed
+    Device output/monitor: none
+    Dependencies: accessDefaultInputReader, readIntegersFromReader
+    */
+    int readIntegersFromFile( int *values, int valueCount )
+       {
+        // read through default input reader, return
+           // function: accessDefaultInputReader, readIntegersFromReader
+        return readIntegersFromReader( accessDefaultInputReader(), 
+                                                         values, valueCount );
+       }
+
+    /*
+    Name: readIntegersFromReader
+    process: ignores leading white space before each value,
+             captures up to the given number of contiguous integers 
+             into the array in one call, parsed straight from the input 
+             buffer; stops early at end of file, setting the end of file 
+             flag as readIntegerFromFile does, or at text that is not 
+             an integer, leaving it unread
+    Function input/parameters: input reader (InputReaderType *),
+                               number of values wanted (int)
+    Function output/parameters: values captured (int *)
+    Function output/returned: number of values captured (int)
+    Device input/file: values captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForReaderOpen, checkForReaderEndOfFile, 
+                  scanLongFromInput
+    */
+    int readIntegersFromReader( InputReaderType *reader, 
+                                                 int *values, int valueCount )
+       {
+        // initialize variables
+        int scanReturn = 1, index = 0;
+        long longVal;
+
+        // check for file open and data accessible
+           // function: checkForReaderOpen, checkForReaderEndOfFile
+        if( checkForReaderOpen( reader ) && !checkForReaderEndOfFile( reader ) )
+           {
+            // loop until array full or no value found
+            while( index < valueCount && scanReturn == 1 )
+               {
+                // get next value
+                   // function: scanLongFromInput
+                scanReturn = scanLongFromInput( &reader->buffer, 
+                                                 reader->filePtr, &longVal );
+
+                // check for value found
+                if( scanReturn == 1 )
+                   {
+                    // place value, move to next element
+                    values[ index ] = (int)longVal;
+
+                    index++;
+                   }
+               }
+
+            // check for end of file found
+            if( scanReturn == EOF )
+               {
+                // set end of file flag
+                reader->endOfFile = true;
+               }
+           }
+
+        // return number of values captured
+        return index;
+       }
+      
     /*
     Name: readLongFromFile
     process: ignores leading unprintable characters,
@@ -428,35 +1038,48 @@ non-commercial use as long as the above copyright statement is included.
                               ZERO_VALUE otherwise
     Device input/file: long value captured from file
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fscanf, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readLongFromReader
     */
     long readLongFromFile()
+       {
+        // read through default input reader, return
+           // function: accessDefaultInputReader, readLongFromReader
+        return readLongFromReader( accessDefaultInputReader() );
+       }
+
+    /*
+    Name: readLongFromReader
+    process: ignores leading unprintable characters,
+             captures first contiguous long int
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: long integer found if successful, 
+                              ZERO_VALUE otherwise
+    Device input/file: long value captured from file
+    Device output/monitor: none
+    Dependencies: checkForReaderOpen, checkForReaderEndOfFile, 
+                  scanLongFromInput
+    */
+    long readLongFromReader( InputReaderType *reader )
        {
         // initialize variables
-        FILE *filePtr = NULL;
         int fscanfReturn = EOF;
         long longVal = ZERO_VALUE;
 
         // check for file open and data accessible
-           // function: checkForInputFileOpen, checkForEndOfInputFile
-        if( checkForInputFileOpen() && !checkForEndOfInputFile() )
+           // function: checkForReaderOpen, checkForReaderEndOfFile
+        if( checkForReaderOpen( reader ) && !checkForReaderEndOfFile( reader ) )
            {
-            // set file pointer
-               // function: accessInputFilePointer
-            filePtr = accessInputFilePointer( GET_INPUT_FILE_PTR, 
-                                                         DUMMY_INPUT_FILE_PTR );
-
             // get long value
-               // function: fscanf
-            fscanfReturn = fscanf( filePtr, "%ld", &longVal );
+               // function: scanLongFromInput
+            fscanfReturn = scanLongFromInput( &reader->buffer, 
+                                                  reader->filePtr, &longVal );
 
             // check for end of file found
             if( fscanfReturn == EOF )
                {
                 // set end of file flag
-                   // function: accessEndOfInputFileFlag
-                accessEndOfInputFileFlag( SET_INPUT_FLAG, true );
+                reader->endOfFile = true;
 
                 // set return value to zero
                 longVal = ZERO_VALUE;
@@ -475,34 +1098,44 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: character found if successful, ZERO_CHAR otherwise
     Device input/file: character captured from file
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fgetc, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readRawCharFromReader
     */
     char readRawCharFromFile()
+       {
+        // read through default input reader, return
+           // function: accessDefaultInputReader, readRawCharFromReader
+        return readRawCharFromReader( accessDefaultInputReader() );
+       }
+
+    /*
+    Name: readRawCharFromReader
+    process: captures first character in file stream including non-printable
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: none
+    Function output/returned: character found if successful, ZERO_CHAR otherwise
+    Device input/file: character captured from file
+    Device output/monitor: none
+    Dependencies: checkForReaderOpen, checkForReaderEndOfFile, 
+                  getInputChar
+    */
+    char readRawCharFromReader( InputReaderType *reader )
        {
         // initialize variables
-        FILE *filePtr = NULL;
         int intChar = (int)ZERO_CHAR;
 
         // check for file open and data accessible
-           // function: checkForInputFileOpen, checkForEndOfInputFile
-        if( checkForInputFileOpen() && !checkForEndOfInputFile() )
+           // function: checkForReaderOpen, checkForReaderEndOfFile
+        if( checkForReaderOpen( reader ) && !checkForReaderEndOfFile( reader ) )
            {
-            // set file pointer
-               // function: accessInputFilePointer
-            filePtr = accessInputFilePointer( GET_INPUT_FILE_PTR, 
-                                                         DUMMY_INPUT_FILE_PTR );
-
             // get character
-               // function: fgetc
-            intChar = fgetc( filePtr );
+               // function: getInputChar
+            intChar = getInputChar( &reader->buffer, reader->filePtr );
 
             // check for end of file found
             if( intChar == EOF )
                {
                 // set end of file flag
-                   // function: accessEndOfInputFileFlag
-                accessEndOfInputFileFlag( SET_INPUT_FLAG, true );
+                reader->endOfFile = true;
 
                 // set return value to zero
                 intChar = (int)ZERO_CHAR;
@@ -529,45 +1162,78 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: success of operation (bool)
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  clearLeadingWhiteSpace, fgetc, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readStringConfiguredFromReader
     */
    bool readStringConfiguredFromFile( bool clearLeadingNonPrintable, 
                                       bool clearLeadingSpace, 
                                       bool stopAtNonPrintable, 
                                       char delimiter,
                                       char *capturedString )
+      {
+       // read through default input reader, return
+          // function: accessDefaultInputReader, readStringConfiguredFromReader
+       return readStringConfiguredFromReader( accessDefaultInputReader(),
+                                              clearLeadingNonPrintable, 
+                                              clearLeadingSpace, 
+                                              stopAtNonPrintable, 
+                                              delimiter,
+                                              capturedString );
+      }
+
+    /*
+    Name: readStringConfiguredFromReader
+    Process: captures string with options:
+             - clear leading non printable (bool)
+             - clear leading space character (bool)
+             - adquires characters up to any non-printable (bool)
+             - adquires characters up to any printable delimiter (char)
+               - use constant NON_PRINTABLE if no delimiter
+             - also stops capture when full (MAX_STR_LEN)
+             Note: This function consumes the last character input,
+             including the space, delimiter, or non-printable character
+    Function input/parameters: input reader (InputReaderType *),
+                               see process above
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: success of operation (bool)
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForReaderOpen, checkForReaderEndOfFile, 
+                  clearBufferWhiteSpace, getInputChar
+    */
+   bool readStringConfiguredFromReader( InputReaderType *reader,
+                                        bool clearLeadingNonPrintable, 
+                                        bool clearLeadingSpace, 
+                                        bool stopAtNonPrintable, 
+                                        char delimiter,
+                                        char *capturedString )
       {
        // initialize variables
        int intChar = EOF, index = 0;
-       FILE *filePtr = NULL;
+       FILE *filePtr = reader->filePtr;
+       InputBufferType *inputBuffer = &reader->buffer;
        
         // initialize output string
         capturedString[ index ] = NULL_CHAR;
 
         // check for file open and data accessible
-           // function: checkForInputFileOpen, checkForEndOfInputFile
-       if( checkForInputFileOpen() && !checkForEndOfInputFile() )
+           // function: checkForReaderOpen, checkForReaderEndOfFile
+       if( checkForReaderOpen( reader ) && !checkForReaderEndOfFile( reader ) )
           {
-           // get file pointer
-              // function: accessFilePtr
-           filePtr = accessInputFilePointer( GET_INPUT_FILE_PTR, 
-                                                         DUMMY_INPUT_FILE_PTR );
-
            // check for clearing non printable
            if( clearLeadingNonPrintable )
               {
                // clear leading white space, with clear space character flag
-                  // function: clearLeadingWhiteSpace
-               intChar = clearLeadingWhiteSpace( filePtr, clearLeadingSpace );
+                  // function: clearBufferWhiteSpace
+               intChar = clearBufferWhiteSpace( inputBuffer, filePtr, 
+                                                          clearLeadingSpace );
               }
 
            // otherwise, assume non printable not cleared
            else
               {
                // get first character
-                  // function: fgetc
-               intChar = fgetc( filePtr );
+                  // function: getInputChar
+               intChar = getInputChar( inputBuffer, filePtr );
 
                // check for clearing spaces
                if( clearLeadingSpace )
@@ -576,8 +1242,8 @@ non-commercial use as long as the above copyright statement is included.
                    while( intChar != EOF && intChar == (int)SPACE )
                       {
                        // capture new character
-                          // function: fgetc
-                       intChar = fgetc( filePtr );
+                          // function: getInputChar
+                       intChar = getInputChar( inputBuffer, filePtr );
                       }
                   }
               }  // end leading character clearing process
@@ -586,8 +1252,7 @@ non-commercial use as long as the above copyright statement is included.
             if( intChar == EOF )
                {
                 // set end of file flag
-                   // function: accessEndOfInputFileFlag
-                accessEndOfInputFileFlag( SET_INPUT_FLAG, true );
+                reader->endOfFile = true;
 
                 // return failed operation
                 return false;
@@ -619,8 +1284,8 @@ non-commercial use as long as the above copyright statement is included.
                 capturedString[ index ] = NULL_CHAR;
 
                 // get next character as integer
-                   // function: fgetc
-                intChar = fgetc( filePtr );
+                   // function: getInputChar
+                intChar = getInputChar( inputBuffer, filePtr );
                }
             // end loop
 
@@ -660,6 +1325,36 @@ non-commercial use as long as the above copyright statement is included.
                                              capturedString );
        }
 
+   /*
+    Name: readStringSegmentFromReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to first space,
+             or end of line, or full string
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: success of operation (bool)
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromReader with appropriate parameters
+    */
+    bool readStringSegmentFromReader( InputReaderType *reader, 
+                                     char *capturedString )
+       {
+        // initialize variables
+        bool clearLeadingNonPrintable = true;
+        bool clearLeadingSpace = true;
+        bool stopAtNonPrintable = true;
+        char delimiter = SPACE;
+
+        // call utility function, return
+        return readStringConfiguredFromReader( reader, 
+                                               clearLeadingNonPrintable, 
+                                               clearLeadingSpace, 
+                                               stopAtNonPrintable, 
+                                               delimiter,
+                                               capturedString );
+       }
+
    /*
     Name: readStringToLineEndFromFile
     process: ignores leading white space, including space character,
@@ -688,6 +1383,36 @@ non-commercial use as long as the above copyright statement is included.
                                              capturedString );
        }
 
+   /*
+    Name: readStringToLineEndFromReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to end of current line
+             or full string
+    Function input/parameters: input reader (InputReaderType *)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: string found if successful
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromReader with appropriate parameters
+    */
+    bool readStringToLineEndFromReader( InputReaderType *reader, 
+                                       char *capturedString )
+       {
+        // initialize variables
+        bool clearLeadingNonPrintable = true;
+        bool clearLeadingSpace = true;
+        bool stopAtNonPrintable = true;
+        char delimiter = NON_PRINTABLE;
+
+        // call utility function, return
+        return readStringConfiguredFromReader( reader, 
+                                               clearLeadingNonPrintable, 
+                                               clearLeadingSpace, 
+                                               stopAtNonPrintable, 
+                                               delimiter,
+                                               capturedString );
+       }
+
    /*
     Name: readStringToDelimiterFromFile
     process: ignores leading white space, including space character,
@@ -714,4 +1439,207 @@ non-commercial use as long as the above copyright statement is included.
                                              capturedString );
        }
 
+   /*
+    Name: readStringToDelimiterFromReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to specified character
+    Function input/parameters: input reader (InputReaderType *),
+                               delimiter (char)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: string found if successful
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromReader with appropriate parameters
+    */
+    bool readStringToDelimiterFromReader( InputReaderType *reader, 
+                                          char delimiter, char *capturedString )
+       {
+        // initialize variables
+        bool clearLeadingNonPrintable = true;
+        bool clearLeadingSpace = true;
+        bool stopAtNonPrintable = true;
+
+        // call utility function, return
+        return readStringConfiguredFromReader( reader, 
+                                               clearLeadingNonPrintable, 
+                                               clearLeadingSpace, 
+                                               stopAtNonPrintable, 
+                                               delimiter,
+                                               capturedString );
+       }
+
+    /*
+    Name: resetInputBuffer
+    process: releases any mapped file span, 
+             then empties the buffer for stdio reading
+    Function input/parameters: pointer to input buffer (InputBufferType *)
+    Function output/parameters: pointer to input buffer (InputBufferType *)
+    Function output/returned: none
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: munmap
+    */
+    void resetInputBuffer( InputBufferType *inputBuffer )
+       {
+#ifdef INPUT_FILE_MAPPING
+        // check for mapped span
+        if( inputBuffer->mapLength > 0 )
+           {
+            // release span
+               // function: munmap
+            munmap( (void *)inputBuffer->bytes, inputBuffer->mapLength );
+           }
+#endif
+
+        // set empty stdio buffer
+        inputBuffer->bytes = inputBuffer->data;
+        inputBuffer->position = 0;
+        inputBuffer->length = 0;
+        inputBuffer->mapLength = 0;
+       }
+
+    /*
+    Name: scanDoubleFromInput
+    process: ignores leading white space, then captures the characters
+             of a decimal value (digits, sign, point, exponent) straight
+             from the input buffer and converts them,
+             leaving the first other character unread
+    Function input/parameters: pointer to input buffer (InputBufferType *),
+                               file pointer (FILE *)
+    Function output/parameters: pointer to input buffer (InputBufferType *),
+                                double value found (double *)
+    Function output/returned: 1 if value found, 0 if other text found,
+                              EOF if end of file found first
+    Device input/file: characters captured from file as needed
+    Device output/monitor: none
+    Dependencies: peekInputChar, isspace, isdigit, strtod
+    */
+    int scanDoubleFromInput( InputBufferType *inputBuffer, FILE *filePtr,
+                                                           double *doubleVal )
+       {
+        // initialize variables
+        char valueString[ MAX_STR_LEN ];
+        char *stopPtr;
+        int index = 0;
+        int intChar = peekInputChar( inputBuffer, filePtr );
+
+        // skip leading white space
+           // function: isspace, peekInputChar
+        while( intChar != EOF && isspace( intChar ) )
+           {
+            inputBuffer->position++;
+
+            intChar = peekInputChar( inputBuffer, filePtr );
+           }
+
+        // check for end of file found
+        if( intChar == EOF )
+           {
+            return EOF;
+           }
+
+        // capture value characters
+           // function: isdigit, peekInputChar
+        while( intChar != EOF && index < MAX_STR_LEN - 1
+               && ( isdigit( intChar ) || intChar == '+' || intChar == '-' 
+                  || intChar == PERIOD || intChar == 'e' || intChar == 'E' ) )
+           {
+            valueString[ index ] = (char)intChar;
+
+            index++;
+
+            inputBuffer->position++;
+
+            intChar = peekInputChar( inputBuffer, filePtr );
+           }
+
+        valueString[ index ] = NULL_CHAR;
+
+        // convert value
+           // function: strtod
+        *doubleVal = strtod( valueString, &stopPtr );
+
+        // return success if any characters converted
+        return stopPtr != valueString ? 1 : 0;
+       }
+
+    /*
+    Name: scanLongFromInput
+    process: ignores leading white space, then captures an optional sign 
+             and digits with a digit loop straight over the input buffer
+             or mapped file span,
+             refilling it when a value runs past its end,
+             leaving the first character after the value unread
+    Function input/parameters: pointer to input buffer (InputBufferType *),
+                               file pointer (FILE *)
+    Function output/parameters: pointer to input buffer (InputBufferType *),
+                                long value found (long *)
+    Function output/returned: 1 if value found, 0 if other text found,
+                              EOF if end of file found first
+    Device input/file: blocks captured from file as needed
+    Device output/monitor: none
+    Dependencies: peekInputChar, isspace, fillInputBuffer
+    */
+    int scanLongFromInput( InputBufferType *inputBuffer, FILE *filePtr,
+                                                               long *longVal )
+       {
+        // initialize variables
+        unsigned long magnitude = 0;
+        bool negative = false, digitFound = false;
+        int intChar = peekInputChar( inputBuffer, filePtr );
+
+        // skip leading white space
+           // function: isspace, peekInputChar
+        while( intChar != EOF && isspace( intChar ) )
+           {
+            inputBuffer->position++;
+
+            intChar = peekInputChar( inputBuffer, filePtr );
+           }
+
+        // check for end of file found
+        if( intChar == EOF )
+           {
+            return EOF;
+           }
+
+        // capture sign
+        if( intChar == '-' || intChar == '+' )
+           {
+            negative = intChar == '-';
 
+            inputBuffer->position++;
+           }
+
+        // loop across buffer refills until a non digit is found
+           // function: fillInputBuffer
+        do
+           {
+            const char *bytes = inputBuffer->bytes;
+
+            while( inputBuffer->position < inputBuffer->length
+                   && bytes[ inputBuffer->position ] >= '0' 
+                   && bytes[ inputBuffer->position ] <= '9' )
+               {
+                magnitude = magnitude * 10 
+                             + ( bytes[ inputBuffer->position ] - '0' );
+
+                inputBuffer->position++;
+
+                digitFound = true;
+               }
+           }
+        while( inputBuffer->position == inputBuffer->length
+                               && fillInputBuffer( inputBuffer, filePtr ) > 0 );
+
+        // check for no digits
+        if( !digitFound )
+           {
+            return 0;
+           }
+
+        // set value with sign
+        *longVal = negative ? -(long)magnitude : (long)magnitude;
+
+        return 1;
+       }
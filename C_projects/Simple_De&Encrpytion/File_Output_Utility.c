@@ -9,6 +9,7 @@ non-commercial use as long as the above copyright statement is included.
 
 // header files
 #include "File_Output_Utility.h"
+#include <stdlib.h>
 
 // local global constants, used only in this file
 
@@ -32,10 +33,175 @@ non-commercial use as long as the above copyright statement is included.
     //   accessOpenFlag
 //    const int SET_OUTPUT_FLAG = 1001;
 
+// data structures, opaque outside this file
+
+    // output writer state: file pointer and the buffer
+    // collecting text until it is written in one block
+    struct OutputWriterStruct
+       {
+        FILE *filePtr;
+        size_t length;
+        char data[ OUTPUT_BUFFER_SIZE ];
+       };
+
+    /*
+    Name: appendToWriter
+    Process: copies characters into the writer buffer,
+             writing the buffer to file each time it fills,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *),
+                               characters to output (const char *),
+                               number of characters (size_t)
+    Function output/parameters: output writer (OutputWriterType *)
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: full buffer blocks written to file
+    Dependencies: memcpy, flushOutputWriter
+    */
+    static bool appendToWriter( OutputWriterType *writer,
+                                      const char *outChars, size_t charCount )
+       {
+        // initialize variables
+        size_t copyCount;
+
+        // loop until all characters placed
+        while( charCount > 0 )
+           {
+            // check for full buffer, write it out
+               // function: flushOutputWriter
+            if( writer->length == OUTPUT_BUFFER_SIZE
+                                             && !flushOutputWriter( writer ) )
+               {
+                // return failed operation
+                return false;
+               }
+
+            // copy as much as fits
+               // function: memcpy
+            copyCount = OUTPUT_BUFFER_SIZE - writer->length;
+
+            if( copyCount > charCount )
+               {
+                copyCount = charCount;
+               }
+
+            memcpy( &writer->data[ writer->length ], outChars, copyCount );
+
+            writer->length += copyCount;
+            outChars += copyCount;
+            charCount -= copyCount;
+           }  
+
+        // return successful operation
+        return true;
+       }
+
+    /*
+    Name: closeWriterFile
+    Process: writes buffered text, closes writer file,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *)
+    Function output/parameters: output writer (OutputWriterType *)
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: output file closed
+    Dependencies: flushOutputWriter, fclose
+    */
+    static bool closeWriterFile( OutputWriterType *writer )
+       {
+        // initialize variables
+        bool written;
+
+        // check for valid file pointer
+        if( writer->filePtr != NULL )
+           {
+            // write all data to the device
+               // function: flushOutputWriter
+            written = flushOutputWriter( writer );
+
+            // close file
+               // function: fclose
+            written = fclose( writer->filePtr ) == 0 && written;
+
+            // set pointer to NULL
+            writer->filePtr = NULL;
+
+            // return operation result
+            return written;
+           }  
+
+        // return failed operation
+        return false;
+       }
+
+    /*
+    Name: openWriterFile
+    Process: opens output file for writer with stdio buffering off,
+             since the writer collects its own blocks,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *),
+                               file name (c-string)
+    Function output/parameters: output writer (OutputWriterType *)
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: output file opened
+    Dependencies: fopen, setvbuf
+    */
+    static bool openWriterFile( OutputWriterType *writer,
+                                                       const char *fileName )
+       {
+        // initialize variables
+        char writeCharacter[] = "w";
+
+        // open file
+           // function: fopen
+        FILE *filePtr = fopen( fileName, writeCharacter );
+
+        // check for success of file open
+        if( filePtr != NULL )
+           {
+            // each block goes straight to the device
+               // function: setvbuf
+            setvbuf( filePtr, NULL, _IONBF, 0 );
+
+            // set writer file, empty buffer
+            writer->filePtr = filePtr;
+            writer->length = 0;
+
+            // return operation success
+            return true;
+           }  
+
+        // return operation failure
+        return false;
+       }
+
+    /*
+    Name: accessDefaultOutputWriter
+    process: allows access to the output writer used by the
+             global-style functions (openOutputFile, writeIntegerToFile, etc.);
+             note: writer is maintained (static) value initialized closed
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: pointer to default writer (OutputWriterType *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    OutputWriterType *accessDefaultOutputWriter()
+       {
+        // initialize writer to closed, empty buffer
+        static OutputWriterType defaultWriter = { NULL, 0, { 0 } };
+
+        // return writer
+        return &defaultWriter;
+       }
+
     /*
     Name: accessOutputFilePointer
     process: allows setting or accessing file pointer;
-             note: pointer is maintained (static) value initialized to NULL
+             note: pointer is kept in default output writer,
+             initialized to NULL
     Function input/parameters: control code (int), file pointer (FILE *)
                                DUMMY_OUTPUT_FILE_PTR used 
                                if not setting file pointer
@@ -43,68 +209,178 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: file pointer (FILE *)
     Device input/file: none
     Device output/monitor: none
-    Dependencies: none
+    Dependencies: accessDefaultOutputWriter
     */
     FILE *accessOutputFilePointer( int ctrlCode, const FILE *filePtr )
        {
-        static FILE *filePointer = NULL;
+        // initialize variables
+           // function: accessDefaultOutputWriter
+        OutputWriterType *writer = accessDefaultOutputWriter();
 
         // check for set new pointer
         if( ctrlCode == SET_OUTPUT_FILE_PTR )
            {
             // set file pointer to parameter
-            filePointer = (FILE *)filePtr;
-           }
+            writer->filePtr = (FILE *)filePtr;
+           }  
 
         // return file pointer
-        return filePointer;
+        return writer->filePtr;
        }
 
     /*
     Name: closeOutputFile
-    Process: closes output file, returns true if successful, false otherwise
+    Process: adds trailing endlines, closes output file, 
+             returns true if successful, false otherwise
     Function input/parameters: none
     Function output/parameters: none
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: output file closed
-    Dependencies: accessOutputFilePointer, fclose
+    Dependencies: accessDefaultOutputWriter, writeEndlinesToWriter,
+                  closeWriterFile
     */
     bool closeOutputFile()
        {
-        // set local file pointer to working file pointer
-           // function: accessOutputFilePointer
-        FILE *filePtr = accessOutputFilePointer( GET_OUTPUT_FILE_PTR, 
-                                                         DUMMY_OUTPUT_FILE_PTR );
+        // initialize variables
+        OutputWriterType *writer = accessDefaultOutputWriter();
 
         // check for valid file pointer
-        if( filePtr != NULL )
+        if( writer->filePtr != NULL )
            {
             // add two more endlines to verify that the data is ended
             // and has at least one extra newline after the data
-               // function: fprintf
-            fprintf( filePtr, "\n\n" );
+               // function: writeEndlinesToWriter
+            writeEndlinesToWriter( writer, 2 );
+           }
 
-            // flush all data to the device
-               // function: fflush
-            fflush( filePtr );
+        // close default writer file, return
+           // function: closeWriterFile
+        return closeWriterFile( writer );
+       }
 
-            // close file
-               // function: fclose
-            fclose( filePtr );
+    /*
+    Name: closeOutputWriter
+    Process: writes buffered text, closes writer file if open,
+             releases writer memory,
+             returns true if file written and closed, false otherwise
+    Function input/parameters: output writer (OutputWriterType *)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: output file closed
+    Dependencies: closeWriterFile, free
+    */
+    bool closeOutputWriter( OutputWriterType *writer )
+       {
+        // initialize variables
+        bool closed = false;
 
-            // set pointer to NULL
-               // function: accessOutputFilePointer
-            accessOutputFilePointer( SET_OUTPUT_FILE_PTR, NULL );
+        // check for valid writer
+        if( writer != NULL )
+           {
+            // close file, release writer
+               // function: closeWriterFile, free
+            closed = closeWriterFile( writer );
 
-            // return successful operation
-            return true;
+            free( writer );
+           }  
+
+        // return operation result
+        return closed;
+       }
+
+    /*
+    Name: flushOutputWriter
+    Process: writes all buffered text to file in one block, empties buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *)
+    Function output/parameters: output writer (OutputWriterType *)
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: buffered text written to file
+    Dependencies: fwrite
+    */
+    bool flushOutputWriter( OutputWriterType *writer )
+       {
+        // initialize variables
+        size_t writeCount;
+
+        // check for open file
+        if( writer->filePtr != NULL )
+           {
+            // write buffer
+               // function: fwrite
+            writeCount = fwrite( writer->data, 1, writer->length,
+                                                             writer->filePtr );
+
+            // check for complete write
+            if( writeCount == writer->length )
+               {
+                // empty buffer, return successful operation
+                writer->length = 0;
+
+                return true;
+               }
            }  
 
         // return failed operation
         return false;
        }
 
+    /*
+    Name: formatIntegerToString
+    Process: converts integer to decimal text without sprintf,
+             filling digits from the end of a small local buffer,
+             returns number of characters placed
+    Function input/parameters: integer to convert (int)
+    Function output/parameters: converted c-string (char *),
+                                at least MAX_INTEGER_CHARS + 1 long
+    Function output/returned: length of converted c-string (int)
+    Device input/file: none
+    Device output/file: none
+    Dependencies: memcpy
+    */
+    int formatIntegerToString( int outVal, char *outStr )
+       {
+        // initialize variables
+        char digits[ MAX_INTEGER_CHARS ];
+        int index = MAX_INTEGER_CHARS;
+        unsigned int magnitude = outVal < 0 ? 0u - (unsigned int)outVal
+                                                     : (unsigned int)outVal;
+        int strLength;
+
+        // place digits, lowest first, at least one
+        do
+           {
+            index--;
+
+            digits[ index ] = (char)( '0' + magnitude % 10 );
+
+            magnitude /= 10;
+           }  
+        while( magnitude > 0 );
+
+        // place sign
+        if( outVal < 0 )
+           {
+            index--;
+
+            digits[ index ] = '-';
+           }  
+
+        // copy to output, end c-string
+           // function: memcpy
+        strLength = MAX_INTEGER_CHARS - index;
+
+        memcpy( outStr, &digits[ index ], strLength );
+
+        outStr[ strLength ] = NULL_CHAR;
+
+        // return length
+        return strLength;
+       }
+
     /*
     Name: openOutputFile
     Process: opens input file, returns true if successful, false otherwise
@@ -113,37 +389,108 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: output file opened
-    Dependencies: accessOutputFilePointer, fopen
+    Dependencies: accessDefaultOutputWriter, openWriterFile
     */
     bool openOutputFile( const char *fileName )
        {
         // initialize variables
-        FILE *filePtr = accessOutputFilePointer( GET_OUTPUT_FILE_PTR, 
-                                                        DUMMY_OUTPUT_FILE_PTR );
-        char writeCharacter[] = "w";
+           // function: accessDefaultOutputWriter
+        OutputWriterType *writer = accessDefaultOutputWriter();
 
         // check for file not open
-        if( filePtr == NULL )
+        if( writer->filePtr == NULL )
            {
-            // open file
-               // function: fopen
-            filePtr = fopen( fileName, writeCharacter );
+            // open file in default writer, return
+               // function: openWriterFile
+            return openWriterFile( writer, fileName );
+           }  
 
-            // check for success of file open
-            if( filePtr != NULL )
-               {
-                // set pointer in access function
-                   // function: accessInputFilePointer
-                accessOutputFilePointer( SET_OUTPUT_FILE_PTR, filePtr );
+        // return operation failure
+        return false;
+       }
 
-                // return operation success
-                return true;
-               }
+    /*
+    Name: openOutputWriter
+    Process: creates an independent output writer with its own buffer
+             and opens the file in it; writers share no state,
+             so several output files may be open at once
+             and each may be used on its own thread,
+             returns writer if successful, NULL otherwise
+    Function input/parameters: file name (c-string)
+    Function output/parameters: none
+    Function output/returned: new writer (OutputWriterType *),
+                              release with closeOutputWriter
+    Device input/file: none
+    Device output/file: output file opened
+    Dependencies: malloc, openWriterFile, free
+    */
+    OutputWriterType *openOutputWriter( const char *fileName )
+       {
+        // create writer
+           // function: malloc
+        OutputWriterType *writer = malloc( sizeof( OutputWriterType ) );
+
+        // check for allocated writer, open file, check for failure
+           // function: openWriterFile
+        if( writer != NULL && !openWriterFile( writer, fileName ) )
+           {
+            // release writer
+               // function: free
+            free( writer );
+
+            writer = NULL;
+           }  
+
+        // return writer
+        return writer;
+       }
+
+    /*
+    Name: rewriteIntegerJustifiedToWriter
+    Process: writes buffered text, then overwrites the justified integer
+             at an earlier position in the file and returns to the end,
+             used to fill in a field whose value is only known
+             after the rest of the file is written,
+             returns true if successful, false otherwise
+    Function input/parameters:
+                    writer - the output writer
+                    filePosition - byte offset of the field (long)
+                    outVal - the integer value to be output
+                    blockSize - the width of the field (int)
+                    justify - "LEFT," "RIGHT," or "CENTER" justification 
+                       in block (c-string)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: integer written over the field in the file
+    Dependencies: flushOutputWriter, fseek, writeIntegerJustifiedToWriter
+    */
+    bool rewriteIntegerJustifiedToWriter( OutputWriterType *writer,
+                    long filePosition, int outVal,
+                                        int blockSize, const char *justified )
+       {
+        // initialize variables
+        bool written;
+
+        // write buffered text, then move to the field,
+        // fails for output that cannot seek
+           // function: flushOutputWriter, fseek
+        if( !flushOutputWriter( writer )
+                       || fseek( writer->filePtr, filePosition, SEEK_SET ) != 0 )
+           {
+            // return failed operation
+            return false;
            }
-        // end of file not previously opened block
 
-        // return operation failure
-        return false;
+        // write the field through the empty buffer
+           // function: writeIntegerJustifiedToWriter, flushOutputWriter
+        written = writeIntegerJustifiedToWriter( writer, outVal,
+                                                        blockSize, justified )
+                  && flushOutputWriter( writer );
+
+        // return to end of file for further output
+           // function: fseek
+        return fseek( writer->filePtr, 0, SEEK_END ) == 0 && written;
        }
 
     /*
@@ -155,27 +502,50 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: character written to file
-    Dependencies: accessOutputFilePointer, fprintf
+    Dependencies: accessDefaultOutputWriter, writeCharacterToWriter
     */
     bool writeCharacterToFile( char outChar )
        {
-        // initialize variables, set file pointer
-           // function: accessOutputFilePointer
-        FILE *filePtr = accessOutputFilePointer( GET_OUTPUT_FILE_PTR, 
-                                                        DUMMY_OUTPUT_FILE_PTR );
+        // write through default output writer, return
+           // function: accessDefaultOutputWriter, writeCharacterToWriter
+        return writeCharacterToWriter( accessDefaultOutputWriter(), outChar );
+       }
 
+    /*
+    Name: writeCharacterToWriter
+    Process: places individual character in writer buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *),
+                               character to output (char)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: character written to file when buffer fills
+    Dependencies: flushOutputWriter
+    */
+    bool writeCharacterToWriter( OutputWriterType *writer, char outChar )
+       {
         // check for open file
-           // function: checkForOutputFileOpen
-        if( filePtr != NULL )
+        if( writer->filePtr != NULL )
            {
-            // write character
-               // function: fprintf
-            fprintf( filePtr, "%c", outChar );
+            // check for full buffer, write it out
+               // function: flushOutputWriter
+            if( writer->length == OUTPUT_BUFFER_SIZE
+                                             && !flushOutputWriter( writer ) )
+               {
+                // return failed operation
+                return false;
+               }
+
+            // place character
+            writer->data[ writer->length ] = outChar;
+
+            writer->length++;
 
             // return successful operation
             return true;
-           }
-      
+           }  
+
         // return failed operation
         return false;
        }
@@ -190,27 +560,45 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: multiple characters written to file
-    Dependencies: writeCharacterToFile
+    Dependencies: accessDefaultOutputWriter, writeCharactersToWriter
     */
     bool writeCharactersToFile( int numChars, char outChar )
        {
-        // check for number of characters remaining,
-        if( numChars > 0 )
+        // write through default output writer, return
+           // function: accessDefaultOutputWriter, writeCharactersToWriter
+        return writeCharactersToWriter( accessDefaultOutputWriter(),
+                                                           numChars, outChar );
+       }
+
+    /*
+    Name: writeCharactersToWriter
+    Process: places multiple copies of a character in writer buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *),
+                               number of characters to output (int),
+                               character to output (char)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: characters written to file when buffer fills
+    Dependencies: writeCharacterToWriter
+    */
+    bool writeCharactersToWriter( OutputWriterType *writer,
+                                                   int numChars, char outChar )
+       {
+        // loop for number of characters remaining
+        while( numChars > 0 )
            {
-            // write character, check for success 
-               // function: writeChar
-            if( writeCharacterToFile( outChar ) )
+            // write character, check for failure
+               // function: writeCharacterToWriter
+            if( !writeCharacterToWriter( writer, outChar ) )
                {
-                // continue recursion, 
-                // check for downstream success
-                   // function: writeChars
-                return writeCharactersToFile( numChars - 1, outChar );
+                // return unsuccessful operation - write operation failed
+                return false;
                }
 
-            // quit recursion
-            // return unsuccessful operation - write operation failed
-            return false;
-           }
+            numChars--;
+           }  
 
         // return successful operation - all characters have been written
         return true;
@@ -234,7 +622,7 @@ non-commercial use as long as the above copyright statement is included.
         // initialize variables, set block size to zero and justified to "LEFT"
         int blockSize = 0;
         char justified[] = "LEFT";
-        
+
         // call to justified function
            // function: writeDoubleJustifiedToFile
         return writeDoubleJustifiedToFile( outVal, precision, 
@@ -255,10 +643,37 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: double written to file as specified
-    Dependencies: sprintf, writeStringJustifiedToFile
+    Dependencies: accessDefaultOutputWriter, writeDoubleJustifiedToWriter
     */
     bool writeDoubleJustifiedToFile( double outVal, int precision, 
                                           int blockSize, const char *justified )
+       {
+        // write through default output writer, return
+           // function: accessDefaultOutputWriter, writeDoubleJustifiedToWriter
+        return writeDoubleJustifiedToWriter( accessDefaultOutputWriter(),
+                                     outVal, precision, blockSize, justified );
+       }
+
+    /*
+    Name: writeDoubleJustifiedToWriter
+    Process: places individual formatted double value in writer buffer
+             justified, returns true if successful, false otherwise
+             writer - the output writer
+             outVal - the double value to be output
+             precision - number of digits to the right of the radix point
+             blockSize - the width of the block within which
+                         to print the integer value (int)
+             justify - "LEFT," "RIGHT," or "CENTER" justification 
+                       in block (c-string)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: double written to file when buffer fills
+    Dependencies: sprintf, writeStringJustifiedToWriter
+    */
+    bool writeDoubleJustifiedToWriter( OutputWriterType *writer,
+                                       double outVal, int precision,
+                                       int blockSize, const char *justified )
        {
         // initialize variables, create temp string for configuration string
         char specStr[ MIN_STR_LEN ];
@@ -275,8 +690,9 @@ non-commercial use as long as the above copyright statement is included.
         sprintf( outStr, specStr, outVal );
 
         // write as string, return result
-           // function: writeStringJustified
-        return writeStringJustifiedToFile( outStr, blockSize, justified );
+           // function: writeStringJustifiedToWriter
+        return writeStringJustifiedToWriter( writer, outStr,
+                                                         blockSize, justified );
        }
 
     /*
@@ -288,28 +704,31 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: newline written to file
-    Dependencies: accessOutputFilePointer, fprintf
+    Dependencies: accessDefaultOutputWriter, writeEndlineToWriter
     */
     bool writeEndlineToFile()
        {
-        // get file pointer, initialize variable
-           // function: accessOutputFilePointer
-        FILE *filePtr = accessOutputFilePointer( GET_OUTPUT_FILE_PTR, 
-                                                        DUMMY_OUTPUT_FILE_PTR );
-
-        // check for open file
-        if( filePtr != NULL )
-           {
-            // print endline to file
-               // function: fprintf
-            fprintf( filePtr, "%c", NEWLINE_CHAR );
-
-            // return successful operation
-            return true;
-           }
+        // write through default output writer, return
+           // function: accessDefaultOutputWriter, writeEndlineToWriter
+        return writeEndlineToWriter( accessDefaultOutputWriter() );
+       }
 
-        // file not open, return failed operation
-        return false;
+    /*
+    Name: writeEndlineToWriter
+    Process: places newline ('\n') in writer buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: newline written to file when buffer fills
+    Dependencies: writeCharacterToWriter
+    */
+    bool writeEndlineToWriter( OutputWriterType *writer )
+       {
+        // place endline, return result
+           // function: writeCharacterToWriter
+        return writeCharacterToWriter( writer, NEWLINE_CHAR );
        }
 
     /*
@@ -322,30 +741,33 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: multiple newline characters written to file
-    Dependencies: writeString
+    Dependencies: accessDefaultOutputWriter, writeEndlinesToWriter
     */
     bool writeEndlinesToFile( int numEndlines )
        {
-        // check for number of characters remaining,
-        if( numEndlines > 0 )
-           {
-            // write endline, check for success 
-               // function: writeEndlineTofile
-            if( writeEndlineToFile() )
-               {
-                // continue recursion, 
-                // check for downstream success
-                   // function: writeEndlinesToFile
-                return writeEndlinesToFile( numEndlines - 1 );
-               }
-
-            // quit recursion
-            // return unsuccessful operation - write operation failed
-            return false;
-           }
+        // write through default output writer, return
+           // function: accessDefaultOutputWriter, writeEndlinesToWriter
+        return writeEndlinesToWriter( accessDefaultOutputWriter(),
+                                                                 numEndlines );
+       }
 
-        // return successful operation - all endlines have been written
-        return true;
+    /*
+    Name: writeEndlinesToWriter
+    Process: places multiple newlines ('\n') in writer buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *),
+                               number of endlines to write (int)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: newlines written to file when buffer fills
+    Dependencies: writeCharactersToWriter
+    */
+    bool writeEndlinesToWriter( OutputWriterType *writer, int numEndlines )
+       {
+        // place endlines, return result
+           // function: writeCharactersToWriter
+        return writeCharactersToWriter( writer, numEndlines, NEWLINE_CHAR );
        }
 
     /*
@@ -364,12 +786,36 @@ non-commercial use as long as the above copyright statement is included.
         // initialize variables, set block size to zero and justified to "LEFT"
         int blockSize = 0;
         char justified[] = "LEFT";
-       
+
         // call to justified function
            // function: writeDoubleJustifiedToFile
         return writeIntegerJustifiedToFile( outVal, blockSize, justified );
        }
 
+    /*
+    Name: writeIntegerToWriter
+    Process: places individual integer in writer buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *),
+                               integer to output (int)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: integer written to file when buffer fills
+    Dependencies: writeIntegerJustifiedToWriter
+    */
+    bool writeIntegerToWriter( OutputWriterType *writer, int outVal )
+       {
+        // initialize variables, set block size to zero and justified to "LEFT"
+        int blockSize = 0;
+        char justified[] = "LEFT";
+
+        // call to justified function
+           // function: writeIntegerJustifiedToWriter
+        return writeIntegerJustifiedToWriter( writer, outVal,
+                                                         blockSize, justified );
+       }
+
     /*
     Name: writeIntegerJustifiedToFile
     Process: writes individual integer to file,
@@ -385,21 +831,49 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: integer written to file as specified
-    Dependencies: sprintf, writeStringJustifiedToFile
+    Dependencies: accessDefaultOutputWriter, writeIntegerJustifiedToWriter
     */
     bool writeIntegerJustifiedToFile( int outVal, int blockSize, 
                                                          const char *justified )
+       {
+        // write through default output writer, return
+           // function: accessDefaultOutputWriter,
+           //           writeIntegerJustifiedToWriter
+        return writeIntegerJustifiedToWriter( accessDefaultOutputWriter(),
+                                                 outVal, blockSize, justified );
+       }
+
+    /*
+    Name: writeIntegerJustifiedToWriter
+    Process: places individual integer in writer buffer,
+             returns true if successful, false otherwise
+    Function input/parameters:
+                    writer - the output writer
+                    outVal - the integer value to be output
+                    blockSize - the width of the block within which
+                         to print the integer value (int)
+                    justify - "LEFT," "RIGHT," or "CENTER" justification 
+                       in block (c-string)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: integer written to file when buffer fills
+    Dependencies: formatIntegerToString, writeStringJustifiedToWriter
+    */
+    bool writeIntegerJustifiedToWriter( OutputWriterType *writer, int outVal,
+                                        int blockSize, const char *justified )
        {
         // initialize variables, create temporary output string
-        char outStr[ MIN_STR_LEN ];
+        char outStr[ MAX_INTEGER_CHARS + 1 ];
 
         // set integer to string
-           // function: sprintf
-        sprintf( outStr, "%d", outVal );
+           // function: formatIntegerToString
+        formatIntegerToString( outVal, outStr );
 
         // write as string, return result
-           // function: writeStringJustified
-        return writeStringJustifiedToFile( outStr, blockSize, justified );
+           // function: writeStringJustifiedToWriter
+        return writeStringJustifiedToWriter( writer, outStr,
+                                                         blockSize, justified );
        }
 
     /*
@@ -420,12 +894,36 @@ non-commercial use as long as the above copyright statement is included.
         // initialize variables, set block size to zero and justified to "LEFT"
         int blockSize = 0;
         char justified[] = "LEFT";
-     
+
         // call to justified function
            // function: writeStringJustifiedToFile
         return writeStringJustifiedToFile( outString, blockSize, justified );
        }
 
+    /*
+    Name: writeStringToWriter
+    Process: places string in writer buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *),
+                               string to output (const char *)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: string written to file when buffer fills
+    Dependencies: writeStringJustifiedToWriter
+    */
+    bool writeStringToWriter( OutputWriterType *writer, const char *outString )
+       {
+        // initialize variables, set block size to zero and justified to "LEFT"
+        int blockSize = 0;
+        char justified[] = "LEFT";
+
+        // call to justified function
+           // function: writeStringJustifiedToWriter
+        return writeStringJustifiedToWriter( writer, outString,
+                                                         blockSize, justified );
+       }
+
     /*
     Name: writeStringJustifiedToFile
     Process: write string to file within specified block size
@@ -440,20 +938,41 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: success of output operation (bool)
     Function input/keyboard: None
     Device output/file: string written to file as specified
-    Dependencies: strlen, strcmp, writeCharactersToFile, fprint
+    Dependencies: accessDefaultOutputWriter, writeStringJustifiedToWriter
     */
     bool writeStringJustifiedToFile( const char *outStr,
                                             int blockSize, const char *justify )
+      {
+       // write through default output writer, return
+          // function: accessDefaultOutputWriter, writeStringJustifiedToWriter
+       return writeStringJustifiedToWriter( accessDefaultOutputWriter(),
+                                                    outStr, blockSize, justify );
+      }
+
+    /*
+    Name: writeStringJustifiedToWriter
+    Process: place string in writer buffer within specified block size
+             and with specified justification
+    Function input/parameters:
+                   writer - the output writer
+ 		           outVal - the string value to be output
+                   blockSize - the width of the block within which
+                               to print the integer value (int)
+                   justify - "LEFT," "RIGHT," or "CENTER" justification 
+                             in block (c-string)
+    Function output/parameters: None
+    Function output/returned: success of output operation (bool)
+    Function input/keyboard: None
+    Device output/file: string written to file when buffer fills
+    Dependencies: strlen, strcmp, writeCharactersToWriter, appendToWriter
+    */
+    bool writeStringJustifiedToWriter( OutputWriterType *writer,
+                       const char *outStr, int blockSize, const char *justify )
       {
        // initialize variables, set pre-, post- spaces to zero
        int preSpaces = 0, postSpaces = 0, strLength;
 
-       // get file pointer
-          // function: accessFileOutputFilePointer
-       FILE *filePtr = accessOutputFilePointer( GET_OUTPUT_FILE_PTR, 
-                                                        DUMMY_OUTPUT_FILE_PTR );
-
-       if( filePtr != NULL )
+       if( writer->filePtr != NULL )
           {
            // find length of string
               // function: strlen
@@ -485,20 +1004,11 @@ non-commercial use as long as the above copyright statement is included.
                postSpaces = blockSize - strLength - preSpaces;
               }
 
-           // print pre spaces, check for success
-              // function: writeCharactersToFile
-           writeCharactersToFile( preSpaces, SPACE );
-              
-           // print string
-              // function: fprintf
-           fprintf( filePtr, "%s", outStr );
-
-           // print post spaces
-              // function: printChars
-           writeCharactersToFile( postSpaces, SPACE );
-
-           // return successful operation
-           return true;
+           // print pre spaces, string, post spaces, return result
+              // function: writeCharactersToWriter, appendToWriter
+           return writeCharactersToWriter( writer, preSpaces, SPACE )
+                  && appendToWriter( writer, outStr, (size_t)strLength )
+                  && writeCharactersToWriter( writer, postSpaces, SPACE );
           }
 
        // return failed operation
@@ -35,12 +35,39 @@ UTILITY USAGE INSTRUCTIONS:
 #include <string.h>
 #include "StandardConstants.h"
 
+// constants shared with other files
+
+    // writer buffer size, longest integer text (sign and 10 digits)
+    typedef enum { OUTPUT_BUFFER_SIZE = 65536, 
+                   MAX_INTEGER_CHARS = 11 } OutputBufferData;
+
+// data structures
+
+    // independent output writer, contents private to File_Output_Utility.c;
+    // created by openOutputWriter, released by closeOutputWriter
+    typedef struct OutputWriterStruct OutputWriterType;
+
 // function prototypes
 
+    /*
+    Name: accessDefaultOutputWriter
+    process: allows access to the output writer used by the
+             global-style functions (openOutputFile, writeIntegerToFile, etc.);
+             note: writer is maintained (static) value initialized closed
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: pointer to default writer (OutputWriterType *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    OutputWriterType *accessDefaultOutputWriter();
+
     /*
     Name: accessOutputFilePointer
     process: allows setting or accessing file pointer;
-             note: pointer is maintained (static) value initialized to NULL
+             note: pointer is kept in default output writer,
+             initialized to NULL
     Function input/parameters: control code (int), file pointer (FILE *)
                                DUMMY_OUTPUT_FILE_PTR used 
                                if not setting file pointer
@@ -48,22 +75,66 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: file pointer (FILE *)
     Device input/file: none
     Device output/monitor: none
-    Dependencies: none
+    Dependencies: accessDefaultOutputWriter
     */
     FILE *accessOutputFilePointer( int ctrlCode, const FILE *filePtr );
 
     /*
     Name: closeOutputFile
-    Process: closes output file, returns true if successful, false otherwise
+    Process: adds trailing endlines, closes output file, 
+             returns true if successful, false otherwise
     Function input/parameters: none
     Function output/parameters: none
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: output file closed
-    Dependencies: accessOutputFilePointer, fclose
+    Dependencies: accessDefaultOutputWriter, writeEndlinesToWriter,
+                  closeWriterFile
     */
     bool closeOutputFile();
 
+    /*
+    Name: closeOutputWriter
+    Process: writes buffered text, closes writer file if open,
+             releases writer memory,
+             returns true if file written and closed, false otherwise
+    Function input/parameters: output writer (OutputWriterType *)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: output file closed
+    Dependencies: closeWriterFile, free
+    */
+    bool closeOutputWriter( OutputWriterType *writer );
+
+    /*
+    Name: flushOutputWriter
+    Process: writes all buffered text to file in one block, empties buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *)
+    Function output/parameters: output writer (OutputWriterType *)
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: buffered text written to file
+    Dependencies: fwrite
+    */
+    bool flushOutputWriter( OutputWriterType *writer );
+
+    /*
+    Name: formatIntegerToString
+    Process: converts integer to decimal text without sprintf,
+             filling digits from the end of a small local buffer,
+             returns number of characters placed
+    Function input/parameters: integer to convert (int)
+    Function output/parameters: converted c-string (char *),
+                                at least MAX_INTEGER_CHARS + 1 long
+    Function output/returned: length of converted c-string (int)
+    Device input/file: none
+    Device output/file: none
+    Dependencies: memcpy
+    */
+    int formatIntegerToString( int outVal, char *outStr );
+
     /*
     Name: openOutputFile
     Process: opens input file, returns true if successful, false otherwise
@@ -72,10 +143,51 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: output file opened
-    Dependencies: accessOutputFilePointer, fopen
+    Dependencies: accessDefaultOutputWriter, openWriterFile
     */
     bool openOutputFile( const char *fileName );
 
+    /*
+    Name: openOutputWriter
+    Process: creates an independent output writer with its own buffer
+             and opens the file in it; writers share no state,
+             so several output files may be open at once
+             and each may be used on its own thread,
+             returns writer if successful, NULL otherwise
+    Function input/parameters: file name (c-string)
+    Function output/parameters: none
+    Function output/returned: new writer (OutputWriterType *),
+                              release with closeOutputWriter
+    Device input/file: none
+    Device output/file: output file opened
+    Dependencies: malloc, openWriterFile, free
+    */
+    OutputWriterType *openOutputWriter( const char *fileName );
+
+    /*
+    Name: rewriteIntegerJustifiedToWriter
+    Process: writes buffered text, then overwrites the justified integer
+             at an earlier position in the file and returns to the end,
+             used to fill in a field whose value is only known
+             after the rest of the file is written,
+             returns true if successful, false otherwise
+    Function input/parameters:
+                    writer - the output writer
+                    filePosition - byte offset of the field (long)
+                    outVal - the integer value to be output
+                    blockSize - the width of the field (int)
+                    justify - "LEFT," "RIGHT," or "CENTER" justification 
+                       in block (c-string)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: integer written over the field in the file
+    Dependencies: flushOutputWriter, fseek, writeIntegerJustifiedToWriter
+    */
+    bool rewriteIntegerJustifiedToWriter( OutputWriterType *writer,
+                    long filePosition, int outVal,
+                                        int blockSize, const char *justified );
+
     /*
     Name: writeCharacterToFile
     Process: writes individual character to file,
@@ -85,10 +197,24 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: character written to file
-    Dependencies: accessOutputFilePointer, fprintf
+    Dependencies: accessDefaultOutputWriter, writeCharacterToWriter
     */
     bool writeCharacterToFile( char outChar );
 
+    /*
+    Name: writeCharacterToWriter
+    Process: places individual character in writer buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *),
+                               character to output (char)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: character written to file when buffer fills
+    Dependencies: flushOutputWriter
+    */
+    bool writeCharacterToWriter( OutputWriterType *writer, char outChar );
+
     /*
     Name: writeCharactersToFile
     Process: writes multiple characters to file,
@@ -99,10 +225,26 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: multiple characters written to file
-    Dependencies: writeCharacterToFile
+    Dependencies: accessDefaultOutputWriter, writeCharactersToWriter
     */
     bool writeCharactersToFile( int numChars, char outChar );
 
+    /*
+    Name: writeCharactersToWriter
+    Process: places multiple copies of a character in writer buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *),
+                               number of characters to output (int),
+                               character to output (char)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: characters written to file when buffer fills
+    Dependencies: writeCharacterToWriter
+    */
+    bool writeCharactersToWriter( OutputWriterType *writer,
+                                                   int numChars, char outChar );
+
     /*
     Name: writeDoubleToFile
     Process: writes individual formatted double value to file,
@@ -132,10 +274,31 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: double written to file as specified
-    Dependencies: sprintf, writeStringJustifiedToFile
+    Dependencies: accessDefaultOutputWriter, writeDoubleJustifiedToWriter
     */
     bool writeDoubleJustifiedToFile( double outVal, int precision, 
-                                         int blockSize, const char *justified );
+                                          int blockSize, const char *justified );
+
+    /*
+    Name: writeDoubleJustifiedToWriter
+    Process: places individual formatted double value in writer buffer
+             justified, returns true if successful, false otherwise
+             writer - the output writer
+             outVal - the double value to be output
+             precision - number of digits to the right of the radix point
+             blockSize - the width of the block within which
+                         to print the integer value (int)
+             justify - "LEFT," "RIGHT," or "CENTER" justification 
+                       in block (c-string)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: double written to file when buffer fills
+    Dependencies: sprintf, writeStringJustifiedToWriter
+    */
+    bool writeDoubleJustifiedToWriter( OutputWriterType *writer,
+                                       double outVal, int precision,
+                                       int blockSize, const char *justified );
 
     /*
     Name: writeEndlineToFile
@@ -146,10 +309,23 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: newline written to file
-    Dependencies: accessOutputFilePointer, fprintf
+    Dependencies: accessDefaultOutputWriter, writeEndlineToWriter
     */
     bool writeEndlineToFile();
 
+    /*
+    Name: writeEndlineToWriter
+    Process: places newline ('\n') in writer buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: newline written to file when buffer fills
+    Dependencies: writeCharacterToWriter
+    */
+    bool writeEndlineToWriter( OutputWriterType *writer );
+
     /*
     Name: writeEndlinesToFile
     Process: writes multiple carriage return ('\r')
@@ -160,10 +336,24 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: multiple newline characters written to file
-    Dependencies: writeString
+    Dependencies: accessDefaultOutputWriter, writeEndlinesToWriter
     */
     bool writeEndlinesToFile( int numEndlines );
 
+    /*
+    Name: writeEndlinesToWriter
+    Process: places multiple newlines ('\n') in writer buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *),
+                               number of endlines to write (int)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: newlines written to file when buffer fills
+    Dependencies: writeCharactersToWriter
+    */
+    bool writeEndlinesToWriter( OutputWriterType *writer, int numEndlines );
+
     /*
     Name: writeIntegerToFile
     Process: writes individual integer to file,
@@ -177,6 +367,20 @@ UTILITY USAGE INSTRUCTIONS:
     */
     bool writeIntegerToFile( int outVal );
 
+    /*
+    Name: writeIntegerToWriter
+    Process: places individual integer in writer buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *),
+                               integer to output (int)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: integer written to file when buffer fills
+    Dependencies: writeIntegerJustifiedToWriter
+    */
+    bool writeIntegerToWriter( OutputWriterType *writer, int outVal );
+
     /*
     Name: writeIntegerJustifiedToFile
     Process: writes individual integer to file,
@@ -192,11 +396,31 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: operation success (bool)
     Device input/file: none
     Device output/file: integer written to file as specified
-    Dependencies: sprintf, writeStringJustifiedToFile
+    Dependencies: accessDefaultOutputWriter, writeIntegerJustifiedToWriter
     */
     bool writeIntegerJustifiedToFile( int outVal, int blockSize, 
                                                          const char *justified );
 
+    /*
+    Name: writeIntegerJustifiedToWriter
+    Process: places individual integer in writer buffer,
+             returns true if successful, false otherwise
+    Function input/parameters:
+                    writer - the output writer
+                    outVal - the integer value to be output
+                    blockSize - the width of the block within which
+                         to print the integer value (int)
+                    justify - "LEFT," "RIGHT," or "CENTER" justification 
+                       in block (c-string)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: integer written to file when buffer fills
+    Dependencies: formatIntegerToString, writeStringJustifiedToWriter
+    */
+    bool writeIntegerJustifiedToWriter( OutputWriterType *writer, int outVal,
+                                        int blockSize, const char *justified );
+
     /*
     Name: writeStringToFile
     Process: writes String value to file,
@@ -212,6 +436,20 @@ UTILITY USAGE INSTRUCTIONS:
     */
     bool writeStringToFile( const char *outString );
 
+    /*
+    Name: writeStringToWriter
+    Process: places string in writer buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: output writer (OutputWriterType *),
+                               string to output (const char *)
+    Function output/parameters: none
+    Function output/returned: operation success (bool)
+    Device input/file: none
+    Device output/file: string written to file when buffer fills
+    Dependencies: writeStringJustifiedToWriter
+    */
+    bool writeStringToWriter( OutputWriterType *writer, const char *outString );
+
     /*
     Name: writeStringJustifiedToFile
     Process: write string to file within specified block size
@@ -226,10 +464,29 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: success of output operation (bool)
     Function input/keyboard: None
     Device output/file: string written to file as specified
-    Dependencies: strlen, strcmp, writeCharactersToFile, fprint
+    Dependencies: accessDefaultOutputWriter, writeStringJustifiedToWriter
     */
     bool writeStringJustifiedToFile( const char *outStr,
                                             int blockSize, const char *justify );
 
+    /*
+    Name: writeStringJustifiedToWriter
+    Process: place string in writer buffer within specified block size
+             and with specified justification
+    Function input/parameters:
+                   writer - the output writer
+ 		           outVal - the string value to be output
+                   blockSize - the width of the block within which
+                               to print the integer value (int)
+                   justify - "LEFT," "RIGHT," or "CENTER" justification 
+                             in block (c-string)
+    Function output/parameters: None
+    Function output/returned: success of output operation (bool)
+    Function input/keyboard: None
+    Device output/file: string written to file when buffer fills
+    Dependencies: strlen, strcmp, writeCharactersToWriter, appendToWriter
+    */
+    bool writeStringJustifiedToWriter( OutputWriterType *writer,
+                       const char *outStr, int blockSize, const char *justify );
 
 #endif  // FILE_OUTPUT_UTILITY_H
\ No newline at end of file
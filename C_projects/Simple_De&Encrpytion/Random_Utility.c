@@ -0,0 +1,137 @@
+// header files
+#include "Random_Utility.h"
+
+/*
+Name: rotateLeft
+process: rotates 64 bit value left by given bit count
+Function input/parameters: value (uint64_t), bit count (int)
+Function output/parameters: none
+Function output/returned: rotated value (uint64_t)
+Device input/file: none
+Device output/monitor: none
+Dependencies: none
+*/
+static inline uint64_t rotateLeft( uint64_t value, int bitCount )
+   {
+    return ( value << bitCount ) | ( value >> ( 64 - bitCount ) );
+   }
+
+/*
+Name: fillRandomDigits
+process: fills array with random digits 0 to 7, taking 21 three bit
+         digits from each generated value, no division needed
+Function input/parameters: random context (RandomContextType *),
+                           number of digits (int)
+Function output/parameters: random context (RandomContextType *),
+                            random digits (unsigned char [])
+Function output/returned: none
+Device input/file: none
+Device output/monitor: none
+Dependencies: nextRandomValue
+*/
+void fillRandomDigits( RandomContextType *randomContext,
+                                        unsigned char digits[], int count )
+   {
+    uint64_t value;
+    int index = 0, digit;
+
+    while( index < count )
+       {
+        value = nextRandomValue( randomContext );
+
+        for( digit = 0; digit < DIGITS_PER_VALUE && index < count; digit++ )
+           {
+            digits[ index ] = (unsigned char)( value & DIGIT_MASK );
+
+            value >>= DIGIT_BITS;
+            index++;
+           }
+       }
+   }
+
+/*
+Name: getRandomBetween
+process: calculates a random number between low and high limits, inclusive,
+         with a multiply and shift in place of a division,
+         rejecting the few values that would bias the result
+Function input/parameters: random context (RandomContextType *),
+                           low and high limits (int)
+Function output/parameters: random context (RandomContextType *)
+Function output/returned: random value generated (int)
+Device input/file: none
+Device output/monitor: none
+Dependencies: nextRandomValue
+*/
+int getRandomBetween( RandomContextType *randomContext,
+                                                   int lowVal, int highVal )
+   {
+    uint32_t range = (uint32_t)( highVal - lowVal ) + 1;
+    uint64_t product = ( nextRandomValue( randomContext ) >> 32 ) * range;
+    uint32_t threshold;
+
+    // low part below range may fall in the biased tail, check it
+    if( (uint32_t)product < range )
+       {
+        threshold = -range % range;
+
+        while( (uint32_t)product < threshold )
+           {
+            product = ( nextRandomValue( randomContext ) >> 32 ) * range;
+           }
+       }
+
+    return lowVal + (int)( product >> 32 );
+   }
+
+/*
+Name: nextRandomValue
+process: advances xoshiro256** generator, gives next 64 bit value
+Function input/parameters: random context (RandomContextType *)
+Function output/parameters: random context (RandomContextType *)
+Function output/returned: random value (uint64_t)
+Device input/file: none
+Device output/monitor: none
+Dependencies: rotateLeft
+*/
+uint64_t nextRandomValue( RandomContextType *randomContext )
+   {
+    uint64_t *state = randomContext->state;
+    uint64_t result = rotateLeft( state[ 1 ] * 5, 7 ) * 9;
+    uint64_t shifted = state[ 1 ] << 17;
+
+    state[ 2 ] ^= state[ 0 ];
+    state[ 3 ] ^= state[ 1 ];
+    state[ 1 ] ^= state[ 2 ];
+    state[ 0 ] ^= state[ 3 ];
+    state[ 2 ] ^= shifted;
+    state[ 3 ] = rotateLeft( state[ 3 ], 45 );
+
+    return result;
+   }
+
+/*
+Name: seedRandomContext
+process: sets generator state from a seed by running splitmix64,
+         so any seed, including zero, gives a usable state
+Function input/parameters: seed (uint64_t)
+Function output/parameters: random context (RandomContextType *)
+Function output/returned: none
+Device input/file: none
+Device output/monitor: none
+Dependencies: none
+*/
+void seedRandomContext( RandomContextType *randomContext, uint64_t seed )
+   {
+    uint64_t mixed;
+    int index;
+
+    for( index = 0; index < 4; index++ )
+       {
+        seed += 0x9E3779B97F4A7C15ULL;
+
+        mixed = ( seed ^ ( seed >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+        mixed = ( mixed ^ ( mixed >> 27 ) ) * 0x94D049BB133111EBULL;
+
+        randomContext->state[ index ] = mixed ^ ( mixed >> 31 );
+       }
+   }
@@ -0,0 +1,82 @@
+#ifndef RANDOM_UTILITY_H
+#define RANDOM_UTILITY_H
+
+// header files
+#include <stdint.h>
+
+// constants
+
+// random bits used per digit 0 to 7, digits taken from one 64 bit value
+typedef enum { DIGIT_BITS = 3, DIGIT_MASK = 7,
+               DIGITS_PER_VALUE = 21 } RandomDigitData;
+
+// data structures
+
+// random generator context, xoshiro256** state; each context is
+// independent, so each thread or stream can own one, and the same
+// seed always gives the same sequence
+typedef struct
+   {
+    uint64_t state[ 4 ];
+   } RandomContextType;
+
+// prototypes
+
+/*
+Name: fillRandomDigits
+process: fills array with random digits 0 to 7, taking 21 three bit
+         digits from each generated value, no division needed
+Function input/parameters: random context (RandomContextType *),
+                           number of digits (int)
+Function output/parameters: random context (RandomContextType *),
+                            random digits (unsigned char [])
+Function output/returned: none
+Device input/file: none
+Device output/monitor: none
+Dependencies: nextRandomValue
+*/
+void fillRandomDigits( RandomContextType *randomContext,
+                                        unsigned char digits[], int count );
+
+/*
+Name: getRandomBetween
+process: calculates a random number between low and high limits, inclusive,
+         with a multiply and shift in place of a division,
+         rejecting the few values that would bias the result
+Function input/parameters: random context (RandomContextType *),
+                           low and high limits (int)
+Function output/parameters: random context (RandomContextType *)
+Function output/returned: random value generated (int)
+Device input/file: none
+Device output/monitor: none
+Dependencies: nextRandomValue
+*/
+int getRandomBetween( RandomContextType *randomContext,
+                                                   int lowVal, int highVal );
+
+/*
+Name: nextRandomValue
+process: advances xoshiro256** generator, gives next 64 bit value
+Function input/parameters: random context (RandomContextType *)
+Function output/parameters: random context (RandomContextType *)
+Function output/returned: random value (uint64_t)
+Device input/file: none
+Device output/monitor: none
+Dependencies: rotateLeft
+*/
+uint64_t nextRandomValue( RandomContextType *randomContext );
+
+/*
+Name: seedRandomContext
+process: sets generator state from a seed by running splitmix64,
+         so any seed, including zero, gives a usable state
+Function input/parameters: seed (uint64_t)
+Function output/parameters: random context (RandomContextType *)
+Function output/returned: none
+Device input/file: none
+Device output/monitor: none
+Dependencies: none
+*/
+void seedRandomContext( RandomContextType *randomContext, uint64_t seed );
+
+#endif   //  RANDOM_UTILITY_H
@@ -2,7 +2,7 @@
 #include "project_8.h"
 
 // main program
-int main()
+int main( int argc, char *argv[] )
    {
     // initialize function
 
@@ -12,11 +12,45 @@ int main()
        char decryptedString[ HUGE_STR_LEN ];
        char downloadChoice;
        int numRows;
+       long numChars;
+       int unknownChar = NOT_IN_TABLE;
        ControlCodes encryptDecrypt;
+       RandomContextType randomContext;
+       uint64_t seed = (uint64_t)time( NULL );
+       char *seedEnd;
+
+       // check for fixed seed request: -seed <value> before other options,
+       // makes encrypted output repeatable
+          // function: strcmp, strtoull
+       if( argc >= 3 && strcmp( argv[ 1 ], "-seed" ) == 0 )
+          {
+           errno = 0;
+           seed = strtoull( argv[ 2 ], &seedEnd, 10 );
+
+           // check for seed that is not all digits or is out of range,
+           // strtoull would skip spaces and negate a minus sign
+              // function: isdigit
+           if( !isdigit( (unsigned char)argv[ 2 ][ 0 ] )
+                                      || *seedEnd != '\0' || errno == ERANGE )
+              {
+               // print usage error
+                  // function: printf
+               printf( "ERROR: -seed needs a whole number from 0 to %llu\n",
+                                             (unsigned long long)UINT64_MAX );
+               printf( "Usage: %s [-seed <value>] [options]\n", argv[ 0 ] );
+
+               // return failed program
+               return 1;
+              }
+
+           // read remaining options as if seed option were absent
+           argc -= 2;
+           argv += 2;
+          }
 
-       // seed random generator
-          // function: srand
-       srand( time( NULL ) );
+       // seed random generator, clock time unless seed given
+          // function: seedRandomContext
+       seedRandomContext( &randomContext, seed );
 
        // initialize lookup array
        char lookupArray[ LOOKUP_ROWS ][ LOOKUP_COLUMNS ] = { { "&ABCDEF." },
@@ -28,9 +62,86 @@ int main()
                                                              { "lmnopqr)" },
                                                              { "stuvwxyz" } };
 
+       // initialize reverse index of lookup array
+          // function: buildReverseIndex
+       int reverseIndex[ REVERSE_INDEX_SIZE ];
+
+       buildReverseIndex( lookupArray, reverseIndex );
+
+       // initialize batch cipher tables, selects vector kernels for this CPU
+          // function: buildCipherBatch
+       CipherBatchType cipherBatch;
+
+       buildCipherBatch( &lookupArray[ 0 ][ 0 ], &cipherBatch );
+
        // initialize data array
        int encryptedDataArray[ ENCRYPTED_ROWS ][ ENCRYPTED_COLUMNS ];
 
+       // check for kernel benchmark request: -benchmark <megabytes>
+       if( argc == 3 && strcmp( argv[ 1 ], "-benchmark" ) == 0 )
+          {
+           // time batch kernels, return failed program if any disagreed
+              // function: reportBatchSpeed, atoi
+           return reportBatchSpeed( &cipherBatch, atoi( argv[ 2 ] ) ) ? 0 : 1;
+          }
+
+       // check for streaming encryption request: -encrypt <input|-> <output>
+       if( argc == 4 && strcmp( argv[ 1 ], "-encrypt" ) == 0 )
+          {
+           // encrypt input of any length straight to encrypted file
+              // function: streamEncryptFile
+           if( streamEncryptFile( &cipherBatch, &randomContext, argv[ 2 ], 
+                                         argv[ 3 ], &numRows, &unknownChar ) )
+              {
+               // show rows written
+                  // function: printf
+               printf( "Encrypted %d rows to %s\n", numRows, argv[ 3 ] );
+
+               // return successful program
+               return 0;
+              }
+
+           // check for character not in lookup table, report it
+              // function: printf
+           if( unknownChar != NOT_IN_TABLE )
+              {
+               printf( "ERROR: Character code %d is not in the lookup table\n",
+                                                                 unknownChar );
+              }
+
+           // print error message
+              // function: printf
+           printf( "ERROR: Streaming encryption failed\n" );
+
+           // return failed program
+           return 1;
+          }
+
+       // check for streaming decryption request: -decrypt <input> <output>
+       if( argc == 4 && strcmp( argv[ 1 ], "-decrypt" ) == 0 )
+          {
+           // decrypt encrypted file of any length straight to file
+              // function: streamDecryptFile
+           if( streamDecryptFile( &cipherBatch, 
+                                        argv[ 2 ], argv[ 3 ], &numChars ) )
+              {
+               // show characters written
+                  // function: printf
+               printf( "Decrypted %ld characters to %s\n", 
+                                                       numChars, argv[ 3 ] );
+
+               // return successful program
+               return 0;
+              }
+
+           // print error message
+              // function: printf
+           printf( "ERROR: Streaming decryption failed\n" );
+
+           // return failed program
+           return 1;
+          }
+
        // show title
           // function: printf
        printf( "\nDATA ENCRYPTION PROGRAM\n" );
@@ -65,8 +176,8 @@ int main()
           {
            // encrypt data
               // function: encryptData
-           numRows = encryptData( lookupArray, 
-                                            encryptedDataArray, encryptString );
+           numRows = encryptData( reverseIndex, &randomContext, 
+                             encryptedDataArray, encryptString, &unknownChar );
           }
 
        // otherwise, assume decrypt
@@ -139,9 +250,17 @@ int main()
               }  
           }
 
-       // otherwise, assume failed file access
+       // otherwise, assume failed file access or encryption
        else
           {
+           // check for character not in lookup table, report it
+              // function: printf
+           if( unknownChar != NOT_IN_TABLE )
+              {
+               printf( "\nERROR: Character '%c' is not in the lookup table", 
+                                                                 unknownChar );
+              }
+
            // print error message
              // function: printf
            printf( "\nERROR: Program encryption/decryption failed, " );
@@ -215,55 +334,6 @@ bool isInString( const char testStr[], char testChar )
 	//return results
 	return false ;
 	
-}
-int getRandBetween( int lowVal, int highVal )
-{
-	//intialize vars and functions
-	int range ;
-	//process data
-	
-	//get digits of random
-	range = highVal - lowVal +1;
-	
-
-	//return random reminder of range and add lowest value 
-	return rand() % range + lowVal ; 
-}
-int getLookupIndex( ControlCodes ctrl, 
-                        char lookupArray[][ LOOKUP_COLUMNS ], char searchChar )
-{
-	//intilaze vars and fucntions
-	int rowCount, columnCount;
-	//proccess data
-	//create loop for columns
-	for (columnCount = 0 ; columnCount < 8 ; columnCount++)
-	{
-		//create loop for rows
-		for(rowCount = 0 ; rowCount < 8 ; rowCount++)
-		{
-			//if array index match the character
-			if (lookupArray[rowCount][columnCount] == searchChar)
-			{
-				//if ctrl needs row index
-				if (ctrl == GET_ROW_INDEX) 
-				{
-					//return row index
-					return rowCount ;
-				}
-				else
-				{
-					//return column index 
-					return columnCount ; 
-				}
-			}
-			
-		}
-	}
-	//stub return 
-	return 0 ;
-	
-	
-	
 }
 char decryptCharacter( char lookupArray[][ LOOKUP_COLUMNS ], int toDecrypt )
 {
@@ -286,59 +356,32 @@ int uploadEncryptedData( const char *fileName,
 {
 		//intailize vars and functions
 		int countColumn,countRow,integer;
-		char rowLine[STD_STR_LEN],delimiter;
+		InputReaderType *reader ;
 		//process data
 		
-
-		//set delimiter
-		delimiter = ':' ;
 		//set count of rows to zero
 		countRow = 0 ;
 		
+		//open file past its row and column lines
+			//function:openEncryptedFile
+		reader = openEncryptedFile(fileName) ;
 		//if file opens
-		if(openInputFile(fileName))
+		if(reader != NULL)
 		{
-			//read row line up to string part
-				//function:readStringToDelimiterFromFile
-			readStringToDelimiterFromFile(  delimiter, rowLine ) ; 
-			//read integer from row ling
-				//function:readIntegerFromFile
-			integer = readIntegerFromFile() ;
-			//read row line up to string part
-				//function:readStringToDelimiterFromFile
-			readStringToDelimiterFromFile(  delimiter, rowLine );
-			//read integer from row ling
-				//function:readIntegerFromFile
-			integer = readIntegerFromFile() ;
-		
-			//prime integer
-				//function:readIntegerFromFile
-			integer = readIntegerFromFile() ;
 			//zero column 
 			countColumn = 0 ;
-			//create while loop so that the file does not end
-			while(!checkForEndOfInputFile())
+			//create while loop so that the array does not overflow
+			//and values remain
+				//function:readEncryptedValue
+			while(countRow < ENCRYPTED_ROWS 
+			                             && readEncryptedValue(reader,&integer))
 			{
-
-				//if integer is not a single zero
-				if (integer != 0)
-				{
-					//set array current index to integer
-					array[countRow][countColumn] = integer ;
-
-				}
-				
+				//set array current index to integer
+				array[countRow][countColumn] = integer ;
 
 				//add to column 
 				 countColumn++ ; 
 				 
-				//reprime integer
-					//function:readIntegerFromFile
-				integer = readIntegerFromFile() ;
-			//skip over comma 
-				//function:readCharacterFromFile
-				readCharacterFromFile() ; 
-				
 				//if columns has reached max
 				if(countColumn == ENCRYPTED_COLUMNS )
 				{
@@ -350,9 +393,9 @@ int uploadEncryptedData( const char *fileName,
 				}
 			}
 			
-			//close input file
-				//function:closeInputFile
-			closeInputFile() ;
+			//close input reader
+				//function:closeInputReader
+			closeInputReader(reader) ;
 		}
 		//return results
 	return countRow ;
@@ -361,110 +404,84 @@ void downloadEncryptedFile( int array[][ ENCRYPTED_COLUMNS ],
                                             int numRows, const char *fileName )
 {
 	//intialize vars and functions 
-	int cCol,cRow,index ;
-	int blockSize = 3; 
-	int lessThan = 100 ;
-	char outStr[STD_STR_LEN] ;
+	int cRow ;
+	OutputWriterType *writer ;
 	//process data
 	
-	//open output file
-		//function:openOutputFile
-	openOutputFile(fileName) ;
-	//fomrat rows string 
-		//function :sprintf
-	sprintf(outStr,"Number of Rows   : %d",numRows);
+	//open output writer, whole matrix is buffered and written in blocks
+		//function:openOutputWriter
+	writer = openOutputWriter(fileName) ;
+	//if file not opened
+	if (writer == NULL)
+	{
+		//nothing to download
+		return ;
+	}
 	//add string of number of rows
-		//function: writeStringToFile 
-	writeStringToFile(outStr) ;
+		//function: writeStringToWriter, writeIntegerToWriter 
+	writeStringToWriter(writer,"Number of Rows   : ") ;
+	writeIntegerToWriter(writer,numRows) ;
 	//write endline to file
-		//function : writeEndlineToFile 
-	writeEndlineToFile() ;
-	//fomrat columns string 
-		//function :sprintf
-	sprintf(outStr,"Number of Columns: %d",ENCRYPTED_COLUMNS);
+		//function : writeEndlineToWriter 
+	writeEndlineToWriter(writer) ;
 	
 	//add string of number of columns
-		//function: writeStringToFile 
-	writeStringToFile(outStr) ;
+		//function: writeStringToWriter, writeIntegerToWriter 
+	writeStringToWriter(writer,"Number of Columns: ") ;
+	writeIntegerToWriter(writer,ENCRYPTED_COLUMNS) ;
 	
 	//write endline to file
-		//function : writeEndlineToFile 
-	writeEndlineToFile() ;
+		//function : writeEndlineToWriter 
+	writeEndlineToWriter(writer) ;
 	//write endline to file
-		//function : writeEndlineToFile 
-	writeEndlineToFile() ;
+		//function : writeEndlineToWriter 
+	writeEndlineToWriter(writer) ;
 	
 	//create a for loop for the rows
 	for (cRow = 0 ;cRow < numRows ; cRow++)
 	{
-	//create a for loop for the columns
-		for(cCol = 0 ; cCol < ENCRYPTED_COLUMNS ; cCol++)
-		{
-			//write space to file 
-				//function:writeCharacterToFile
-			writeCharacterToFile(SPACE);
-			//set array index 
-			index = array[cRow][cCol] ;
-			//if index is less than 100
-			if (index < lessThan )
-			{
-				//add zero to file
-					//function: writeIntegerToFile
-				writeIntegerToFile( LOW_SINGLE_DIGIT ) ;	
-			}
-			//add integer to file
-				//function: writeIntegerToFile
-			writeIntegerJustifiedToFile( index,blockSize,"RIGHT") ;
-			//if column not at limit
-			if (cCol != ENCRYPTED_COLUMNS - 1)
-			{
-				//write comma to file 
-					//function: writeStringToFile
-				writeCharacterToFile(COMMA);
-				writeCharacterToFile(SPACE); 
-			}
-		}
-		//write endline to file
-			//function : writeEndlineToFile 
-		writeEndlineToFile() ;
+		//write row to file
+			//function: writeEncryptedRow
+		writeEncryptedRow(writer,array[cRow]) ;
 	}
 
-	//close output file 
-		//function: closeOutputFile 
-		closeOutputFile() ;
+	//add two more endlines, the data is ended with an extra newline
+		//function: writeEndlinesToWriter
+	writeEndlinesToWriter(writer,2) ;
+	//close output writer, flushing the buffered matrix
+		//function: closeOutputWriter 
+		closeOutputWriter(writer) ;
 	
 	
 }
-int encryptCharacter( char lookupArray[][ LOOKUP_COLUMNS ], char toEncrypt )
+int encryptCharacter( const int reverseIndex[], 
+                             RandomContextType *randomContext, char toEncrypt )
 {
 	//intialize vars and functions
-	ControlCodes ctrl ;
-	int row,column, randNum,rowMuti,randMuti;
-	//set ctrl to get row
-	ctrl = GET_ROW_INDEX ;
-	//get row
-		//function:getLookupIndex
-	row= getLookupIndex( ctrl, lookupArray, toEncrypt ) ;
-	//set ctrl to get column
-	ctrl = GET_COLUMN_INDEX ;
-	//get column
-		//function:getLookupIndex
-	column= getLookupIndex( ctrl, lookupArray, toEncrypt ) ;
+	int rowAndColumn, randNum,randMuti;
+	//get packed row and column with one index load
+	rowAndColumn = reverseIndex[(unsigned char)toEncrypt] ;
+	//if character not in table
+	if (rowAndColumn == NOT_IN_TABLE)
+	{
+		//report it
+		return NOT_IN_TABLE ;
+	}
 	//get the random number
-		//function:getRandBetween
-	randNum= getRandBetween( LOW_SINGLE_DIGIT, HIGH_SINGLE_DIGIT ) ;
-	//get column mutiplied
-	rowMuti = row * FIRST_MULTIPLIER_DIGIT ;
+		//function:getRandomBetween
+	randNum= getRandomBetween( randomContext, 
+	                                      LOW_SINGLE_DIGIT, HIGH_SINGLE_DIGIT ) ;
 	//get random mutiplied
 	randMuti = randNum * SECOND_MULTIPLIER_DIGIT ;
 	
 	//return integer
-	return randMuti + rowMuti + column ; 
+	return randMuti + rowAndColumn ; 
 	
 		
 }
-int encryptData( char lookupArray[][ LOOKUP_COLUMNS ],
-                 int array[][ ENCRYPTED_COLUMNS ], const char encryptString[] )
+int encryptData( const int reverseIndex[], RandomContextType *randomContext,
+                 int array[][ ENCRYPTED_COLUMNS ], 
+                             const char encryptString[], int *unknownChar )
 {
 	//intialize vars and functions
 	int rowInd,columnInd,value,encVal;
@@ -478,6 +495,8 @@ int encryptData( char lookupArray[][ LOOKUP_COLUMNS ],
 	value= 0 ;
 	//set row to zero
 	rowInd = 0 ;
+	//no unknown character yet
+	*unknownChar = NOT_IN_TABLE ;
 	
 	//while loop for end of string
 	while (encryptString[value] != NULL_CHAR)
@@ -487,7 +506,14 @@ int encryptData( char lookupArray[][ LOOKUP_COLUMNS ],
 		stringInd = encryptString[value] ;
 		//encrypt Character
 			//function : encryptCharacter
-		encVal = encryptCharacter(lookupArray,stringInd) ;
+		encVal = encryptCharacter(reverseIndex,randomContext,stringInd) ;
+		//if character not in table
+		if (encVal == NOT_IN_TABLE)
+		{
+			//report it, nothing encrypted
+			*unknownChar = (unsigned char)stringInd ;
+			return 0 ;
+		}
 		//set new value to array
 		array[rowInd][columnInd] = encVal ;
 		//if column as reached 5 
@@ -514,7 +540,7 @@ int encryptData( char lookupArray[][ LOOKUP_COLUMNS ],
 		stringInd = SPACE;
 		//encrypt Character
 			//function : encryptCharacter
-		encVal = encryptCharacter(lookupArray,stringInd) ;
+		encVal = encryptCharacter(reverseIndex,randomContext,stringInd) ;
 		//add to array 
 		array[rowInd][columnInd] = encVal ;
 		//reprime
@@ -565,6 +591,8 @@ void decryptData( char lookupArray[][ LOOKUP_COLUMNS ],
 				iterCol = 0 ;
 			}
 	}	
+	//end the string
+	decryptStr[value] = NULL_CHAR ;
 		
 	
 	
@@ -572,4 +600,364 @@ void decryptData( char lookupArray[][ LOOKUP_COLUMNS ],
 
 	
 	
+}
+bool writeEncryptedRow( OutputWriterType *writer, const int rowArray[] )
+{
+	//intialize vars and functions
+	int cCol,index,lessThan ;
+	bool written ;
+	//process data
+	
+	//set written to true
+	written = true ;
+	//create a for loop for the columns
+	for(cCol = 0 ; cCol < ENCRYPTED_COLUMNS ; cCol++)
+	{
+		//write space to file 
+			//function:writeCharacterToWriter
+		written = writeCharacterToWriter(writer,SPACE) && written ;
+		//set array index 
+		index = rowArray[cCol] ;
+		//add a leading zero for each missing digit, so 43 is written 043
+		for (lessThan = SECOND_MULTIPLIER_DIGIT ; lessThan > 1 && index < lessThan ;
+		                                     lessThan /= FIRST_MULTIPLIER_DIGIT)
+		{
+			//add zero to file
+				//function: writeIntegerToWriter
+			written = writeIntegerToWriter(writer, LOW_SINGLE_DIGIT ) 
+			                                                        && written ;
+		}
+		//add integer to file
+			//function: writeIntegerToWriter
+		written = writeIntegerToWriter(writer, index) && written ;
+		//if column not at limit
+		if (cCol != ENCRYPTED_COLUMNS - 1)
+		{
+			//write comma to file 
+				//function: writeCharacterToWriter
+			written = writeCharacterToWriter(writer,COMMA) && written ;
+			written = writeCharacterToWriter(writer,SPACE) && written ; 
+		}
+	}
+	//write endline to file
+		//function : writeEndlineToWriter 
+	written = writeEndlineToWriter(writer) && written ;
+	
+	//return results
+	return written ;
+}
+bool streamEncryptFile( const CipherBatchType *cipherBatch, 
+                        RandomContextType *randomContext,
+                        const char *inFileName, const char *outFileName, 
+                                             int *numRows, int *unknownChar )
+{
+	//intialize vars and functions
+	const char *rowLeader = "Number of Rows   : " ;
+	char chunk[STREAM_CHUNK_SIZE] ;
+	unsigned char randDigits[STREAM_CHUNK_SIZE] ;
+	int values[STREAM_CHUNK_SIZE] ;
+	int rowArray[ENCRYPTED_COLUMNS] ;
+	int columnInd,textCount,encCount,valueInd ;
+	size_t chunkSize,chunkInd ;
+	char stringInd ;
+	bool written ;
+	FILE *inFile ;
+	OutputWriterType *writer ;
+	//process data
+	
+	//set rows to zero, no unknown character yet
+	*numRows = 0 ;
+	*unknownChar = NOT_IN_TABLE ;
+	//use standard input for a dash, otherwise open input file
+		//function: strcmp, fopen
+	inFile = stdin ;
+	if (strcmp(inFileName,"-") != 0)
+	{
+		inFile = fopen(inFileName,"r") ;
+	}
+	//if input not available
+	if (inFile == NULL)
+	{
+		//nothing to encrypt
+		return false ;
+	}
+	//open output writer
+		//function:openOutputWriter
+	writer = openOutputWriter(outFileName) ;
+	//if file not opened
+	if (writer == NULL)
+	{
+		//close input file if one was opened
+			//function: fclose
+		if (inFile != stdin)
+		{
+			fclose(inFile) ;
+		}
+		//nothing to encrypt
+		return false ;
+	}
+	//add row leader with a blank field, filled in once rows are known
+		//function: writeStringToWriter, writeIntegerJustifiedToWriter
+	written = writeStringToWriter(writer,rowLeader) ;
+	written = writeIntegerJustifiedToWriter(writer,0,ROW_COUNT_WIDTH,"LEFT")
+	                                                                && written ;
+	written = writeEndlineToWriter(writer) && written ;
+	//add string of number of columns
+		//function: writeStringToWriter, writeIntegerToWriter 
+	written = writeStringToWriter(writer,"Number of Columns: ") && written ;
+	written = writeIntegerToWriter(writer,ENCRYPTED_COLUMNS) && written ;
+	written = writeEndlinesToWriter(writer,2) && written ;
+	
+	//zero column
+	columnInd = 0 ;
+	//prime chunk
+		//function: fread
+	chunkSize = fread(chunk,1,STREAM_CHUNK_SIZE,inFile) ;
+	//while input remains and all characters were found
+	while (chunkSize > 0 && *unknownChar == NOT_IN_TABLE)
+	{
+		//set text count to zero
+		textCount = 0 ;
+		//loop through the chunk, moving text to its front
+		for (chunkInd = 0 ; chunkInd < chunkSize ; chunkInd++)
+		{
+			//get string index
+			stringInd = chunk[chunkInd] ;
+			//if not a carriage return
+			if (stringInd != CARRIAGE_RETURN_CHAR)
+			{
+				//line ends are not in the lookup table, use space
+				if (stringInd == NEWLINE_CHAR)
+				{
+					stringInd = SPACE ;
+				}
+				//keep character
+				chunk[textCount] = stringInd ;
+				textCount++ ;
+			}
+		}
+		//get random digits for the chunk in one call
+			//function: fillRandomDigits
+		fillRandomDigits(randomContext,randDigits,textCount) ;
+		//encrypt the chunk in one batch
+			//function: encryptCharacterBatch
+		encCount = encryptCharacterBatch(cipherBatch,chunk,randDigits,
+		                                                    values,textCount) ;
+		//if batch stopped at a character not in table
+		if (encCount < textCount)
+		{
+			//report it, stops the loop
+			*unknownChar = (unsigned char)chunk[encCount] ;
+		}
+		//place encrypted values in rows
+		for (valueInd = 0 ; valueInd < encCount ; valueInd++)
+		{
+			//add value to row
+			rowArray[columnInd] = values[valueInd] ;
+			columnInd++ ;
+			//if columns has reached limit 
+			if (columnInd == ENCRYPTED_COLUMNS)
+			{
+				//write row to file
+					//function: writeEncryptedRow
+				written = writeEncryptedRow(writer,rowArray) && written ;
+				//start new row
+				(*numRows)++ ;
+				columnInd = 0 ;
+			}
+		}
+		//reprime chunk
+			//function: fread
+		chunkSize = fread(chunk,1,STREAM_CHUNK_SIZE,inFile) ;
+	}
+	//if last row started, fill it out with spaces
+	if (columnInd > 0 && *unknownChar == NOT_IN_TABLE)
+	{
+		//set spaces to column limit
+		for (textCount = 0 ; columnInd + textCount < ENCRYPTED_COLUMNS ; 
+		                                                          textCount++)
+		{
+			chunk[textCount] = SPACE ;
+		}
+		//get their random digits
+			//function: fillRandomDigits
+		fillRandomDigits(randomContext,randDigits,textCount) ;
+		//encrypt spaces into the rest of the row
+			//function: encryptCharacterBatch
+		encryptCharacterBatch(cipherBatch,chunk,randDigits,
+		                                         &rowArray[columnInd],textCount) ;
+		//write row to file
+			//function: writeEncryptedRow
+		written = writeEncryptedRow(writer,rowArray) && written ;
+		(*numRows)++ ;
+	}
+	//check for unknown character and read error, 
+	//close input file if one was opened
+		//function: ferror, fclose
+	written = *unknownChar == NOT_IN_TABLE && !ferror(inFile) && written ;
+	if (inFile != stdin)
+	{
+		fclose(inFile) ;
+	}
+	//fill in the number of rows
+		//function: rewriteIntegerJustifiedToWriter, strlen
+	written = rewriteIntegerJustifiedToWriter(writer,(long)strlen(rowLeader),
+	                                 *numRows,ROW_COUNT_WIDTH,"LEFT") && written ;
+	//add two more endlines, the data is ended with an extra newline
+		//function: writeEndlinesToWriter
+	written = writeEndlinesToWriter(writer,2) && written ;
+	//close output writer
+		//function: closeOutputWriter 
+	written = closeOutputWriter(writer) && written ;
+	
+	//return results
+	return written ;
+}
+InputReaderType *openEncryptedFile( const char *fileName )
+{
+	//intialize vars and functions
+	char rowLine[STD_STR_LEN] ;
+	InputReaderType *reader ;
+	//process data
+	
+	//open input reader
+		//function: openInputReader
+	reader = openInputReader(fileName) ;
+	//if file opens
+	if (reader != NULL)
+	{
+		//read past row line
+			//function:readStringToDelimiterFromReader, readIntegerFromReader
+		readStringToDelimiterFromReader(reader,COLON,rowLine) ;
+		readIntegerFromReader(reader) ;
+		//read past column line
+			//function:readStringToDelimiterFromReader, readIntegerFromReader
+		readStringToDelimiterFromReader(reader,COLON,rowLine) ;
+		readIntegerFromReader(reader) ;
+	}
+	//return results
+	return reader ;
+}
+bool readEncryptedValue( InputReaderType *reader, int *value )
+{
+	//intialize vars and functions
+	int found ;
+	//process data
+	
+	//get value
+		//function: readIntegersFromReader
+	found = readIntegersFromReader(reader,value,1) ;
+	//if stopped at a comma, skip it and get value after it
+		//function: checkForReaderEndOfFile, readRawCharFromReader
+	if (found == 0 && !checkForReaderEndOfFile(reader) 
+	                                   && readRawCharFromReader(reader) == COMMA)
+	{
+		found = readIntegersFromReader(reader,value,1) ;
+	}
+	//return results, each digit must be within the lookup table
+	return found == 1 && *value >= 0 
+	   && *value / SECOND_MULTIPLIER_DIGIT <= HIGH_SINGLE_DIGIT
+	   && *value / FIRST_MULTIPLIER_DIGIT % FIRST_MULTIPLIER_DIGIT 
+	                                                      <= HIGH_SINGLE_DIGIT
+	   && *value % FIRST_MULTIPLIER_DIGIT <= HIGH_SINGLE_DIGIT ;
+}
+bool streamDecryptFile( const CipherBatchType *cipherBatch,
+             const char *inFileName, const char *outFileName, long *numChars )
+{
+	//intialize vars and functions
+	int values[STREAM_CHUNK_SIZE] ;
+	char text[STREAM_CHUNK_SIZE + 1] ;
+	int valueCount ;
+	bool written ;
+	InputReaderType *reader ;
+	OutputWriterType *writer ;
+	//process data
+	
+	//set characters to zero
+	*numChars = 0 ;
+	//open file past its row and column lines
+		//function:openEncryptedFile
+	reader = openEncryptedFile(inFileName) ;
+	//if file not opened
+	if (reader == NULL)
+	{
+		//nothing to decrypt
+		return false ;
+	}
+	//open output writer
+		//function:openOutputWriter
+	writer = openOutputWriter(outFileName) ;
+	//if file not opened
+	if (writer == NULL)
+	{
+		//close input reader
+			//function: closeInputReader
+		closeInputReader(reader) ;
+		//nothing to decrypt
+		return false ;
+	}
+	
+	//set written to true
+	written = true ;
+	//loop while full batches of values are read
+	do
+	{
+		//read values up to batch limit
+			//function: readEncryptedValue
+		valueCount = 0 ;
+		while (valueCount < STREAM_CHUNK_SIZE 
+		                    && readEncryptedValue(reader,&values[valueCount]))
+		{
+			valueCount++ ;
+		}
+		//decrypt the batch and add it to file
+			//function: decryptValueBatch, writeStringToWriter
+		decryptValueBatch(cipherBatch,values,text,valueCount) ;
+		text[valueCount] = NULL_CHAR ;
+		written = writeStringToWriter(writer,text) && written ;
+		//add to characters
+		*numChars += valueCount ;
+	}
+	while (valueCount == STREAM_CHUNK_SIZE) ;
+	//values must have run to the end of file
+		//function: checkForReaderEndOfFile
+	written = checkForReaderEndOfFile(reader) && written ;
+	
+	//close input reader and output writer
+		//function: closeInputReader, closeOutputWriter
+	closeInputReader(reader) ;
+	written = closeOutputWriter(writer) && written ;
+	
+	//return results
+	return written ;
+}
+void buildReverseIndex( char lookupArray[][ LOOKUP_COLUMNS ], 
+                                                          int reverseIndex[] )
+{
+	//intialize vars and functions
+	int rowCount,columnCount,charCode ;
+	//process data
+	
+	//set all characters as not in table
+	for (charCode = 0 ; charCode < REVERSE_INDEX_SIZE ; charCode++)
+	{
+		reverseIndex[charCode] = NOT_IN_TABLE ;
+	}
+	//create loop for columns, same search order as the table scan
+	for (columnCount = 0 ; columnCount < LOOKUP_COLUMNS ; columnCount++)
+	{
+		//create loop for rows
+		for(rowCount = 0 ; rowCount < LOOKUP_ROWS ; rowCount++)
+		{
+			//get character code
+			charCode = (unsigned char)lookupArray[rowCount][columnCount] ;
+			//if first time character is found
+			if (reverseIndex[charCode] == NOT_IN_TABLE)
+			{
+				//set packed row and column
+				reverseIndex[charCode] = rowCount * FIRST_MULTIPLIER_DIGIT 
+				                                                  + columnCount ;
+			}
+		}
+	}
 }
\ No newline at end of file
@@ -6,8 +6,12 @@
 #include "Console_IO_Utility.h"
 #include "File_Input_Utility.h"
 #include "File_Output_Utility.h"
-#include <stdlib.h>  // for srand, rand
-#include <time.h>  // for srand
+#include "Cipher_Batch_Utility.h"
+#include "Random_Utility.h"
+#include <stdlib.h>  // for atoi, strtoull
+#include <errno.h>  // for seed range check
+#include <ctype.h>  // for seed digit check
+#include <time.h>  // for default seed
 
 // constants
 
@@ -15,11 +19,30 @@ typedef enum { LOOKUP_ROWS = 8, LOOKUP_COLUMNS = 8,
                   ENCRYPTED_COLUMNS = 5, ENCRYPTED_ROWS = 50 } ArrayCapacities;
 typedef enum { FIRST_MULTIPLIER_DIGIT = 10, 
                                       SECOND_MULTIPLIER_DIGIT = 100 } DigitType;
-typedef enum { DECRYPT, ENCRYPT, GET_ROW_INDEX, GET_COLUMN_INDEX } ControlCodes;
+typedef enum { DECRYPT, ENCRYPT } ControlCodes;
 typedef enum { LOW_SINGLE_DIGIT = 0, HIGH_SINGLE_DIGIT = 7 } DigitLimits;
+typedef enum { STREAM_CHUNK_SIZE = 4096, ROW_COUNT_WIDTH = 10 } StreamCapacities;
+typedef enum { REVERSE_INDEX_SIZE = 256, NOT_IN_TABLE = -1 } ReverseIndexData;
 
 // prototypes
 
+/*
+Name: buildReverseIndex
+process: builds index from every character code to the packed row and
+         column digits of that character in the look up table,
+         row times FIRST_MULTIPLIER_DIGIT plus column,
+         characters not in the table are set to NOT_IN_TABLE,
+         built once so each encryption is a single index load
+Function input/parameters: look up array (char [][])
+Function output/parameters: reverse index (int []), REVERSE_INDEX_SIZE long
+Function output/returned: none
+Device input/file: none
+Device output/monitor: none
+Dependencies: none
+*/
+void buildReverseIndex( char lookupArray[][ LOOKUP_COLUMNS ], 
+                                                          int reverseIndex[] );
+
 /*
 Name: decryptCharacter
 process: translates integer value to character, using look up table,
@@ -38,7 +61,7 @@ char decryptCharacter( char lookupArray[][ LOOKUP_COLUMNS ], int toDecrypt );
 /*
 Name: decryptdata
 process: iterates through encrypted array of integers,
-         translates all to characters
+         translates all to characters, ends the string
 Function input/parameters: look up array (char [][]), 
                            integer array with encrypted values (int [][]),
                            number of rows (int)
@@ -56,8 +79,9 @@ Name: downloadEncryptedFile
 process: opens file for download, 
          downloads number of rows and columns with leader text,
          downloads the integer array in formatted structure,
-         assumes ENCRYPTED_COLUMNS number of columns
-         then closes file
+         assumes ENCRYPTED_COLUMNS number of columns,
+         adds two trailing endlines then closes file; text collects in the output writer buffer
+         and reaches the file in a few block writes
 Function input/parameters: array to be downloaded (int [][]),
                            number of rows (int),
                            file name (const char *)
@@ -65,73 +89,54 @@ Function output/parameters: none
 Function output/returned: none
 Device input/file: none
 Device output/file: data output to file as specified
-Dependencies: File Output utilities, sprintf
+Dependencies: File Output writer utilities, writeEncryptedRow
 */
 void downloadEncryptedFile( int array[][ ENCRYPTED_COLUMNS ], 
                                             int numRows, const char *fileName );
 
 /*
 Name: encryptCharacter
-process: encrypts character using look up table,
+process: encrypts character using reverse index of look up table,
          first digit is random, 
          second digit is the row number of the character 
          found in the lookup array,
          third digit is the column number of the character 
          found in the lookup array
-Function input/parameters: look up array (char [][]), 
+Function input/parameters: reverse index (const int []), 
+                           random context (RandomContextType *),
                            value to be encyrypted (char)
-Function output/parameters: none
-Function output/returned: encrypted value (int)
+Function output/parameters: random context (RandomContextType *)
+Function output/returned: encrypted value (int),
+                          NOT_IN_TABLE if character not in look up table
 Device input/file: none
 Device output/monitor: none
-Dependencies: getLookupIndex, getRandBetween
+Dependencies: getRandomBetween
 */
-int encryptCharacter( char lookupArray[][ LOOKUP_COLUMNS ], char toEncrypt );
+int encryptCharacter( const int reverseIndex[], 
+                             RandomContextType *randomContext, char toEncrypt );
 
 /*
 Name: encryptData
 process: encrypts given string as a series of 2- or 3- digit integers,
          if string characters do not fill out a row in the array,
-         spaces are added as encrypted values to fill out the row
-Function input/parameters: look up array (char [][]), 
+         spaces are added as encrypted values to fill out the row,
+         stops at a character not in the look up table
+Function input/parameters: reverse index (const int []), 
+                           random context (RandomContextType *),
                            string to be encrypted (const char [])
-Function output/parameters: array to which encrypted data is loaded (int [][])
-Function output/returned: number of rows used in array (int)
+Function output/parameters: random context (RandomContextType *),
+                            array to which encrypted data is loaded (int [][]),
+                            code of character not in look up table (int *),
+                            NOT_IN_TABLE if all were found
+Function output/returned: number of rows used in array (int),
+                          zero if a character was not found
 Device input/file: none
 Device output/monitor: none
 Dependencies: encryptCharacter
 */
-int encryptData( char lookupArray[][ LOOKUP_COLUMNS ],
-                 int array[][ ENCRYPTED_COLUMNS ], const char encryptString[] );
-
-/*
-Name: getLookupIndex
-process: searches for character in lookup array 
-         and returns either the row index or column index of the character,
-         depending on control code (GET_ROW_INDEX, GET_COLUMN_INDEX),
-         uses only one pair of search loops for this function
-Function input/parameters: look up array (char [][]), 
-                           string to be encrypted (const char [])
-Function output/parameters: array to which encrypted data is loaded (int [][])
-Function output/returned: number of rows used in array (int)
-Device input/file: none
-Device output/monitor: none
-Dependencies: none
-*/
-int getLookupIndex( ControlCodes ctrl, 
-                        char lookupArray[][ LOOKUP_COLUMNS ], char searchChar );
-
-/*
-Name: getRandBetween
-process: calculates a random number between low and high limits, inclusive
-Function input/parameters: low and high limits (int)
-Function output/parameters: none
-Function output/returned: random value generated (int)
-Device input/file: none
-Device output/monitor: none
-Dependencies: rand
-*/
-int getRandBetween( int lowVal, int highVal );
+int encryptData( const int reverseIndex[], RandomContextType *randomContext,
+                 int array[][ ENCRYPTED_COLUMNS ], 
+                             const char encryptString[], int *unknownChar );
 
 /*
 Name: getUserChoices
@@ -162,10 +167,90 @@ Dependencies: none
 */
 bool isInString( const char testStr[], char testChar );
 
+/*
+Name: openEncryptedFile
+process: opens encrypted file in an input reader,
+         reads past the row and column leader lines
+         so the first encrypted value is next
+Function input/parameters: file name (const char *)
+Function output/parameters: none
+Function output/returned: reader at first value (InputReaderType *),
+                          NULL if file not opened
+Device input/file: leader lines input from file
+Device output/monitor: none
+Dependencies: File Input reader utilities
+*/
+InputReaderType *openEncryptedFile( const char *fileName );
+
+/*
+Name: readEncryptedValue
+process: reads next encrypted value, skipping one comma separator,
+         reports false at end of file, at other text,
+         or for a value whose digits are outside the lookup table
+Function input/parameters: input reader (InputReaderType *)
+Function output/parameters: encrypted value found (int *)
+Function output/returned: success of operation (bool)
+Device input/file: value input from file
+Device output/monitor: none
+Dependencies: File Input reader utilities
+*/
+bool readEncryptedValue( InputReaderType *reader, int *value );
+
+/*
+Name: streamDecryptFile
+process: reads encrypted values from encrypted file in batches,
+         decrypts each batch with the vector kernels and places the text
+         in an output writer, which writes to file in large blocks,
+         memory use does not depend on the file length,
+         fails if a value is not valid encrypted data
+Function input/parameters: batch cipher tables (const CipherBatchType *), 
+                           encrypted file name (const char *),
+                           plain text file name (const char *)
+Function output/parameters: number of characters decrypted (long *)
+Function output/returned: success of operation (bool)
+Device input/file: encrypted data input from file as specified
+Device output/file: plain text output to file as specified
+Dependencies: openEncryptedFile, readEncryptedValue, decryptValueBatch,
+              File Input reader utilities, File Output writer utilities
+*/
+bool streamDecryptFile( const CipherBatchType *cipherBatch,
+             const char *inFileName, const char *outFileName, long *numChars );
+
+/*
+Name: streamEncryptFile
+process: reads plain text from file, or from standard input for "-",
+         in fixed size chunks, encrypts each chunk with the vector kernels
+         and writes full rows straight to the encrypted file format,
+         line ends are encrypted as spaces, carriage returns are skipped,
+         last row is filled out with spaces,
+         number of rows is filled in after the input ends,
+         two trailing endlines end the file,
+         memory use does not depend on the input length,
+         fails at a character not in the look up table
+Function input/parameters: batch cipher tables (const CipherBatchType *), 
+                           random context (RandomContextType *),
+                           plain text file name (const char *),
+                           encrypted file name (const char *)
+Function output/parameters: random context (RandomContextType *),
+                            number of rows written (int *),
+                            code of character not in look up table (int *),
+                            NOT_IN_TABLE if all were found
+Function output/returned: success of operation (bool)
+Device input/file: plain text from file or standard input
+Device output/file: encrypted data output to file as specified
+Dependencies: fopen, fread, fillRandomDigits, encryptCharacterBatch, 
+              writeEncryptedRow, fclose, File Output writer utilities
+*/
+bool streamEncryptFile( const CipherBatchType *cipherBatch, 
+                        RandomContextType *randomContext,
+                        const char *inFileName, const char *outFileName, 
+                                             int *numRows, int *unknownChar );
+
 /*
 Name: uploadEncryptedData
 process: opens file for input, acquires row and column limits,
          then uploads all integers thereafter placing them into an array,
+         up to ENCRYPTED_ROWS rows, 
          then closes file and returns number of rows found,
          assumes ENCRYPTED_COLUMNS number of columns
 Function input/parameters: file name (const char *)
@@ -173,9 +258,24 @@ Function output/parameters: array to which data is loaded (int [][])
 Function output/returned: number of rows found in file
 Device input/file: data input from file as specified
 Device output/monitor: none
-Dependencies: File I/O utilities 
+Dependencies: openEncryptedFile, readEncryptedValue, closeInputReader
 */
 int uploadEncryptedData( const char *fileName, 
                                              int array[][ ENCRYPTED_COLUMNS ] );
 
+/*
+Name: writeEncryptedRow
+process: places one row of encrypted values in the writer,
+         each as a three digit field, comma separated, 
+         followed by an endline
+Function input/parameters: output writer (OutputWriterType *),
+                           row of encrypted values (const int [])
+Function output/parameters: none
+Function output/returned: success of operation (bool)
+Device input/file: none
+Device output/file: row written to file when writer buffer fills
+Dependencies: File Output writer utilities
+*/
+bool writeEncryptedRow( OutputWriterType *writer, const int rowArray[] );
+
 #endif   //  PROJECT_8_H